@@ -76,6 +76,11 @@
 # include <sys/resource.h>
 # define _VL_HAVE_GETRLIMIT
 #endif
+#if !defined(_WIN32) && !defined(__MINGW32__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# define _VL_HAVE_MMAP
+#endif
 
 #include "verilated_threads.h"
 // clang-format on
@@ -111,6 +116,8 @@ VerilatedContext* Verilated::s_lastContextp = nullptr;
 // Internal note: Globals may multi-construct, see verilated.cpp top.
 thread_local Verilated::ThreadLocal Verilated::t_s;
 
+std::atomic<uint64_t> VerilatedContextImpData::s_nameMapGeneration{0};
+
 //===========================================================================
 // User definable functions
 // Note a TODO is a future version of the API will pass a structure so that
@@ -2137,41 +2144,47 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
     addrr = m_addr;
     return inData;  // EOF
 }
-void VlReadMem::setData(void* valuep, const std::string& rhs) {
-    const QData shift = m_hex ? 4ULL : 1ULL;
+// Shift the digits in [beginp, endp) into a $readmem array element, ignoring '_'
+static void _vl_readmem_set(bool hex, int bits, void* valuep, const char* beginp,
+                            const char* endp) VL_MT_SAFE {
+    const QData shift = hex ? 4ULL : 1ULL;
     bool innum = false;
     // Shift value in
-    for (const auto& i : rhs) {
-        const char c = std::tolower(i);
-        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
+    for (const char* cp = beginp; cp != endp; ++cp) {
+        if (*cp == '_') continue;
+        const char c = std::tolower(*cp);
+        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(hex ? 4 : 1)
                           : (c >= 'a')           ? (c - 'a' + 10)
                                                  : (c - '0');
-        if (m_bits <= 8) {
+        if (bits <= 8) {
             CData* const datap = reinterpret_cast<CData*>(valuep);
             if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= 16) {
+            *datap = ((*datap << shift) + value) & VL_MASK_I(bits);
+        } else if (bits <= 16) {
             SData* const datap = reinterpret_cast<SData*>(valuep);
             if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= VL_IDATASIZE) {
+            *datap = ((*datap << shift) + value) & VL_MASK_I(bits);
+        } else if (bits <= VL_IDATASIZE) {
             IData* const datap = reinterpret_cast<IData*>(valuep);
             if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= VL_QUADSIZE) {
+            *datap = ((*datap << shift) + value) & VL_MASK_I(bits);
+        } else if (bits <= VL_QUADSIZE) {
             QData* const datap = reinterpret_cast<QData*>(valuep);
             if (!innum) *datap = 0;
             *datap = ((*datap << static_cast<QData>(shift)) + static_cast<QData>(value))
-                     & VL_MASK_Q(m_bits);
+                     & VL_MASK_Q(bits);
         } else {
             WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
-            if (!innum) VL_ZERO_W(m_bits, datap);
-            _vl_shiftl_inplace_w(m_bits, datap, static_cast<IData>(shift));
+            if (!innum) VL_ZERO_W(bits, datap);
+            _vl_shiftl_inplace_w(bits, datap, static_cast<IData>(shift));
             datap[0] |= value;
         }
         innum = true;
     }
 }
+void VlReadMem::setData(void* valuep, const std::string& rhs) {
+    _vl_readmem_set(m_hex, m_bits, valuep, rhs.data(), rhs.data() + rhs.size());
+}
 
 VlWriteMem::VlWriteMem(bool hex, int bits, const std::string& filename, QData start, QData end)
     : m_hex{hex}
@@ -2267,6 +2280,294 @@ void VlWriteMem::print(QData addr, bool addrstamp, const void* valuep) {
     }
 }
 
+//===========================================================================
+// Fast $readmem loading
+
+// Read-only mapping of an entire $readmem file
+class VlReadMemMap final {
+    const char* m_datap = nullptr;  // File contents, nullptr if could not map
+    size_t m_size = 0;  // File size in bytes
+
+    VL_UNCOPYABLE(VlReadMemMap);
+
+public:
+    explicit VlReadMemMap(const std::string& filename) {
+#ifdef _VL_HAVE_MMAP
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat sb;
+        if (::fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            void* const mapp = ::mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapp != MAP_FAILED) {
+                ::madvise(mapp, sb.st_size, MADV_SEQUENTIAL);
+                m_datap = static_cast<const char*>(mapp);
+                m_size = sb.st_size;
+            }
+        }
+        ::close(fd);
+#endif
+    }
+    ~VlReadMemMap() {
+#ifdef _VL_HAVE_MMAP
+        if (m_datap) ::munmap(const_cast<char*>(m_datap), m_size);
+#endif
+    }
+    bool isOpen() const { return m_datap != nullptr; }
+    const char* datap() const { return m_datap; }
+    size_t size() const { return m_size; }
+};
+
+// Section of a $readmem text file parsed by one thread
+struct VlReadMemChunk final {
+    const char* m_beginp = nullptr;  // First character, always at the start of a line
+    const char* m_endp = nullptr;  // One past the last character
+    QData m_startAddr = 0;  // Address of the first value
+    QData m_endAddr = 0;  // Next address at end of chunk
+    QData m_lines = 0;  // Newlines in chunk
+    bool m_anyAddr = false;  // Had address directive in the chunk
+    bool m_slow = false;  // Needs VlReadMem (block comment, 4-state value, error)
+    std::vector<std::pair<QData, QData>> m_ranges;  // [begin, end) addresses read
+    size_t m_relRanges = 0;  // Leading m_ranges before any address directive
+};
+
+// Bytes used by each element of an unpacked array of the given width
+static size_t _vl_readmem_bytes(int bits) VL_PURE {
+    if (bits <= 8) return sizeof(CData);
+    if (bits <= 16) return sizeof(SData);
+    if (bits <= VL_IDATASIZE) return sizeof(IData);
+    if (bits <= VL_QUADSIZE) return sizeof(QData);
+    return VL_WORDS_I(bits) * sizeof(EData);
+}
+
+// Threads to use on a file, roughly one per megabyte, up to the context's thread count
+static size_t _vl_readmem_threads(size_t size) VL_MT_SAFE {
+    const size_t threads = Verilated::threadContextp()->threads();
+    return std::max<size_t>(1, std::min<size_t>({threads, 32, size >> 20}));
+}
+
+// Call fn(0) to fn(n - 1), each on its own thread
+template <typename T_Fn>
+static void _vl_readmem_parallel(size_t n, const T_Fn& fn) VL_MT_SAFE {
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (size_t i = 1; i < n; ++i) threads.emplace_back(fn, i);
+    fn(0);
+    for (std::thread& thread : threads) thread.join();
+}
+
+// Parse a chunk, accepting only the common $readmem syntax; anything else
+// sets m_slow.  If memp is nullptr record m_ranges, else write elements to
+// memp, which holds array addresses lo up to hi.
+static void _vl_readmem_chunk(bool hex, int bits, QData lo, QData hi, char* memp,
+                              VlReadMemChunk& chunk) VL_MT_SAFE {
+    const size_t bytes = _vl_readmem_bytes(bits);
+    QData addr = chunk.m_startAddr;
+    bool readingAddress = false;
+    bool ignoreToEol = false;
+    const char* valuep = nullptr;  // Start of the value being read
+    const auto store = [&](const char* endp) -> bool {
+        if (memp) {
+            if (VL_UNLIKELY(addr < lo || addr >= hi)) return false;
+            _vl_readmem_set(hex, bits, memp + (addr - lo) * bytes, valuep, endp);
+        } else if (!chunk.m_ranges.empty() && chunk.m_ranges.back().second == addr) {
+            ++chunk.m_ranges.back().second;
+        } else {
+            chunk.m_ranges.emplace_back(addr, addr + 1);
+        }
+        valuep = nullptr;
+        return true;
+    };
+    for (const char* cp = chunk.m_beginp; cp != chunk.m_endp; ++cp) {
+        const char c = *cp;
+        if (c == '_') continue;  // Ignore _ e.g. inside a number
+        if (ignoreToEol) {
+            if (c == '\n') {
+                ++chunk.m_lines;
+                ignoreToEol = false;
+            }
+            continue;
+        }
+        const bool chIsHex = std::isxdigit(static_cast<unsigned char>(c));
+        const bool chIsData = hex ? chIsHex : (c == '0' || c == '1');
+        if (valuep) {
+            if (chIsData) continue;
+            if (VL_UNLIKELY(!store(cp))) {
+                chunk.m_slow = true;
+                return;
+            }
+            ++addr;
+        }
+        if (c == '\n') {
+            ++chunk.m_lines;
+            readingAddress = false;
+        } else if (c == ' ' || c == '\t' || c == '\r' || c == '\f') {
+            readingAddress = false;
+        } else if (c == '/' && cp + 1 != chunk.m_endp && cp[1] == '/') {
+            ++cp;
+            ignoreToEol = true;
+        } else if (c == '#') {
+            ignoreToEol = true;
+        } else if (c == '@') {
+            if (!chunk.m_anyAddr) chunk.m_relRanges = chunk.m_ranges.size();
+            chunk.m_anyAddr = true;
+            readingAddress = true;
+            addr = 0;
+        } else if (readingAddress && chIsHex) {
+            const int lc = std::tolower(c);
+            addr = (addr << 4) + ((lc >= 'a') ? (lc - 'a' + 10) : (lc - '0'));
+        } else if (chIsData) {
+            valuep = cp;
+        } else {
+            chunk.m_slow = true;
+            return;
+        }
+    }
+    if (valuep) {
+        // As with VlReadMem, a value at end of file does not advance the address
+        if (VL_UNLIKELY(!store(chunk.m_endp))) {
+            chunk.m_slow = true;
+            return;
+        }
+    }
+    if (!chunk.m_anyAddr) chunk.m_relRanges = chunk.m_ranges.size();
+    chunk.m_endAddr = addr;
+}
+
+// Clear bits above the element width, which Verilated code expects to be zero
+static void _vl_readmem_mask(int bits, char* memp, QData count) VL_MT_SAFE {
+    const size_t bytes = _vl_readmem_bytes(bits);
+    if (static_cast<size_t>(bits) == bytes * 8) return;
+    for (QData i = 0; i < count; ++i) {
+        char* const elemp = memp + i * bytes;
+        if (bits <= 8) {
+            *reinterpret_cast<CData*>(elemp) &= VL_MASK_I(bits);
+        } else if (bits <= 16) {
+            *reinterpret_cast<SData*>(elemp) &= VL_MASK_I(bits);
+        } else if (bits <= VL_IDATASIZE) {
+            *reinterpret_cast<IData*>(elemp) &= VL_MASK_I(bits);
+        } else if (bits <= VL_QUADSIZE) {
+            *reinterpret_cast<QData*>(elemp) &= VL_MASK_Q(bits);
+        } else {
+            reinterpret_cast<EData*>(elemp)[VL_WORDS_I(bits) - 1] &= VL_MASK_E(bits);
+        }
+    }
+}
+
+// Copy a raw image (see VlReadMemImageHeader) into the array
+static void _vl_readmem_image(int bits, QData lo, QData hi, const std::string& filename,
+                              char* memp, const VlReadMemMap& map) VL_MT_SAFE {
+    const size_t bytes = _vl_readmem_bytes(bits);
+    VlReadMemImageHeader header;
+    std::memcpy(&header, map.datap(), sizeof(header));
+    if (VL_UNLIKELY(header.m_bits != static_cast<uint32_t>(bits) || header.m_bytes != bytes)) {
+        VL_FATAL_MT(filename.c_str(), 0, "", "$readmem image element width does not match array");
+        return;
+    }
+    if (VL_UNLIKELY((map.size() - sizeof(header)) / bytes < header.m_count)) {
+        VL_FATAL_MT(filename.c_str(), 0, "", "$readmem image file truncated");
+        return;
+    }
+    if (VL_UNLIKELY(header.m_addr < lo || header.m_addr > hi
+                    || header.m_count > hi - header.m_addr)) {
+        VL_FATAL_MT(filename.c_str(), 0, "", "$readmem file address beyond bounds of array");
+        return;
+    }
+    // Split the copy so page faults on the mapping are also taken in parallel
+    const char* const srcp = map.datap() + sizeof(header);
+    char* const destp = memp + (header.m_addr - lo) * bytes;
+    const size_t n = _vl_readmem_threads(header.m_count * bytes);
+    _vl_readmem_parallel(n, [&](size_t i) {
+        const QData begin = header.m_count * i / n;
+        const QData count = header.m_count * (i + 1) / n - begin;
+        std::memcpy(destp + begin * bytes, srcp + begin * bytes, count * bytes);
+        _vl_readmem_mask(bits, destp + begin * bytes, count);
+    });
+}
+
+// Read a $readmem file into an unpacked array without VlReadMem, splitting
+// large text files by line across threads.  Returns false if the file must
+// instead be read by VlReadMem, which also reports any errors.
+static bool _vl_readmem_fast(bool hex, int bits, QData depth, int array_lsb,
+                             const std::string& filename, void* memp, QData start,
+                             QData end) VL_MT_SAFE {
+    const VlReadMemMap map{filename};
+    if (!map.isOpen()) return false;
+    const QData lo = array_lsb;
+    const QData hi = lo + depth;
+    char* const bytep = static_cast<char*>(memp);
+
+    if (map.size() >= sizeof(VlReadMemImageHeader)
+        && std::memcmp(map.datap(), "VLMEMIMG", 8) == 0) {
+        _vl_readmem_image(bits, lo, hi, filename, bytep, map);
+        return true;
+    }
+
+    // Split into chunks at line boundaries
+    const size_t n = _vl_readmem_threads(map.size());
+    const char* const mapEndp = map.datap() + map.size();
+    std::vector<VlReadMemChunk> chunks(n);
+    for (size_t i = 0; i < n; ++i) {
+        VlReadMemChunk& chunk = chunks[i];
+        chunk.m_beginp = i ? chunks[i - 1].m_endp : map.datap();
+        chunk.m_endp = mapEndp;
+        if (i == n - 1) break;
+        const char* const splitp
+            = std::max(chunk.m_beginp, map.datap() + map.size() * (i + 1) / n);
+        const void* const eolp = std::memchr(splitp, '\n', mapEndp - splitp);
+        if (eolp) chunk.m_endp = static_cast<const char*>(eolp) + 1;
+    }
+
+    QData addr = start;
+    if (n == 1) {
+        // Small file, so read directly; if VlReadMem is needed it will rewrite the same values
+        chunks[0].m_startAddr = start;
+        _vl_readmem_chunk(hex, bits, lo, hi, bytep, chunks[0]);
+        if (chunks[0].m_slow) return false;
+        addr = chunks[0].m_endAddr;
+    } else {
+        // Find each chunk's addresses, relative to the chunk start until an address directive
+        _vl_readmem_parallel(n, [&](size_t i) {  //
+            _vl_readmem_chunk(hex, bits, lo, hi, nullptr, chunks[i]);
+        });
+        std::vector<std::pair<QData, QData>> ranges;
+        for (VlReadMemChunk& chunk : chunks) {
+            if (chunk.m_slow) return false;
+            chunk.m_startAddr = addr;
+            chunk.m_lines = 0;  // Recounted when read
+            for (size_t r = 0; r < chunk.m_ranges.size(); ++r) {
+                std::pair<QData, QData> range = chunk.m_ranges[r];
+                if (r < chunk.m_relRanges) {
+                    range.first += addr;
+                    range.second += addr;
+                }
+                ranges.push_back(range);
+            }
+            addr = chunk.m_anyAddr ? chunk.m_endAddr : addr + chunk.m_endAddr;
+        }
+        // Overlapping writes must happen in file order, so leave them to VlReadMem
+        std::sort(ranges.begin(), ranges.end());
+        for (size_t r = 0; r < ranges.size(); ++r) {
+            if (ranges[r].first < lo || ranges[r].second > hi) return false;
+            if (r && ranges[r].first < ranges[r - 1].second) return false;
+        }
+        _vl_readmem_parallel(n, [&](size_t i) {  //
+            _vl_readmem_chunk(hex, bits, lo, hi, bytep, chunks[i]);
+        });
+    }
+
+    bool anyAddr = false;
+    QData lines = 0;
+    for (const VlReadMemChunk& chunk : chunks) {
+        anyAddr |= chunk.m_anyAddr;
+        lines += chunk.m_lines;
+    }
+    if (VL_UNLIKELY(end != ~0ULL && addr <= end && !anyAddr)) {
+        VL_WARN_MT(filename.c_str(), static_cast<int>(lines), "",
+                   "$readmem file ended before specified final address (IEEE 1800-2023 21.4)");
+    }
+    return true;
+}
+
 void VL_READMEM_N(bool hex,  // Hex format, else binary
                   int bits,  // M_Bits of each array row
                   QData depth,  // Number of rows
@@ -2279,6 +2580,8 @@ void VL_READMEM_N(bool hex,  // Hex format, else binary
                   ) VL_MT_SAFE {
     if (start < static_cast<QData>(array_lsb)) start = array_lsb;
 
+    if (_vl_readmem_fast(hex, bits, depth, array_lsb, filename, memp, start, end)) return;
+
     VlReadMem rmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!rmem.isOpen())) return;
     while (true) {
@@ -2560,6 +2863,14 @@ std::string VerilatedContext::coverageFilename() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_coverageFilename;
 }
+void VerilatedContext::coverageBinary(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_coverageBinary = flag;
+}
+bool VerilatedContext::coverageBinary() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_coverageBinary;
+}
 void VerilatedContext::dumpfile(const std::string& flag) VL_MT_SAFE_EXCLUDES(m_timeDumpMutex) {
     const VerilatedLockGuard lock{m_timeDumpMutex};
     m_dumpfile = flag;
@@ -2831,6 +3142,8 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         uint64_t u64;
         if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
             coverageFilename(str);
+        } else if (arg == "+verilator+coverage+binary") {
+            coverageBinary(true);
         } else if (arg == "+verilator+debug") {
             Verilated::debug(4);
         } else if (commandArgVlUint64(arg, "+verilator+debugi+", u64, 0,
@@ -2981,6 +3294,7 @@ void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    ++VerilatedContextImpData::s_nameMapGeneration;
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
@@ -2988,6 +3302,7 @@ void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    ++VerilatedContextImpData::s_nameMapGeneration;
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
@@ -31,7 +31,9 @@
 #include <deque>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -90,6 +92,36 @@ public:
     ~VerilatedCoverItemSpec() override = default;
 };
 
+//=============================================================================
+// VerilatedCoverItemSharded
+// Coverage item whose count is split into per-thread shards
+
+class VerilatedCoverItemSharded final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    const VerilatedCovShardedCount m_item;  // Counters to sum
+public:
+    // METHODS
+    uint64_t count() const override {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < m_item.m_shards; ++i) {
+            sum += m_item.m_countp[i * m_item.m_stride].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+    void zero() const override {
+        for (uint32_t i = 0; i < m_item.m_shards; ++i) {
+            m_item.m_countp[i * m_item.m_stride].store(0, std::memory_order_relaxed);
+        }
+    }
+    // CONSTRUCTORS
+    explicit VerilatedCoverItemSharded(const VerilatedCovShardedCount& item)
+        : m_item{item} {
+        zero();
+    }
+    ~VerilatedCoverItemSharded() override = default;
+};
+
 //=============================================================================
 // VerilatedCovImp
 //
@@ -101,8 +133,8 @@ public:
 class VerilatedCovImp final : public VerilatedCovContext {
 private:
     // TYPES
-    using ValueIndexMap = std::map<const std::string, int>;
-    using IndexValueMap = std::map<int, std::string>;
+    using ValueIndexMap = std::unordered_map<std::string, int>;
+    using IndexValueMap = std::unordered_map<int, std::string>;
     using ItemList = std::deque<VerilatedCovImpItem*>;
 
     // MEMBERS
@@ -362,13 +394,14 @@ public:
         const VerilatedLockGuard lock{m_mutex};
         selftest();
 
-        std::ofstream os{filename};
+        const bool binary = m_contextp->coverageBinary();
+        std::ofstream os{filename, binary ? std::ios::binary | std::ios::out : std::ios::out};
         if (os.fail()) {
             const std::string msg = "%Error: Can't write '"s + filename + "'";
             VL_FATAL_MT("", 0, "", msg.c_str());
             return;
         }
-        os << "# SystemC::Coverage-3\n";
+        if (!binary) os << "# SystemC::Coverage-3\n";
 
         // Build list of events; totalize if collapsing hierarchy
         std::map<const std::string, std::pair<std::string, uint64_t>> eventCounts;
@@ -415,6 +448,22 @@ public:
             }
         }
 
+        if (binary) {
+            std::deque<std::string> names;  // Deque, as points refer to the names
+            std::vector<std::pair<const std::string*, uint64_t>> points;
+            points.reserve(eventCounts.size());
+            for (const auto& i : eventCounts) {
+                const std::string* namep = &i.first;
+                if (!i.second.first.empty()) {
+                    names.push_back(i.first + keyValueFormatter(VL_CIK_HIER, i.second.first));
+                    namep = &names.back();
+                }
+                points.emplace_back(namep, i.second.second);
+            }
+            VerilatedCovBinary::write(os, points);
+            return;
+        }
+
         // Output body
         for (const auto& i : eventCounts) {
             os << "C '" << std::dec;
@@ -426,6 +475,9 @@ public:
     }
 };
 
+//=============================================================================
+// VerilatedCovShardedCount
+
 //=============================================================================
 // VerilatedCovContext
 
@@ -447,6 +499,9 @@ void VerilatedCovContext::_inserti(uint32_t* itemp) VL_MT_SAFE {
 void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
     impp()->inserti(new VerilatedCoverItemSpec<uint64_t>{itemp});
 }
+void VerilatedCovContext::_inserti(const VerilatedCovShardedCount& item) VL_MT_SAFE {
+    impp()->inserti(new VerilatedCoverItemSharded{item});
+}
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
 }
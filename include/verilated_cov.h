@@ -29,12 +29,61 @@
 
 #include "verilated.h"
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <string>
 
 class VerilatedCovImp;
 
+//=============================================================================
+/// Reference to one coverage count kept in per-thread shards.
+/// The count is the sum of m_shards counters, each m_stride apart.
+
+struct VerilatedCovShardedCount final {
+    std::atomic<uint32_t>* m_countp;  // Counter in the first shard
+    size_t m_stride;  // Distance between one shard's counter and the next
+    uint32_t m_shards;  // Number of shards
+
+    /// Shard index of the calling thread: its thread pool index, so the threads of a
+    /// model use distinct shards however many other threads or pools there are
+    static uint32_t threadShard() VL_MT_SAFE { return Verilated::poolIndex(); }
+};
+
+//=============================================================================
+/// Coverage counters split into per-thread shards, used by models built with
+/// --coverage-per-thread.  Each thread increments the counters of its own
+/// shard, and shards do not share cache lines, so threads incrementing the
+/// same point do not contend.  The shards are summed when coverage is
+/// written.  Threads outside the model's thread pool share the main
+/// thread's shard, so increments remain atomic.
+
+template <std::size_t N_Bins, std::size_t N_Shards>
+class VlCoverageShards final {
+    // Counters per cache line
+    static constexpr size_t LINE_COUNTS = VL_CACHE_LINE_BYTES / sizeof(std::atomic<uint32_t>);
+    // Distance between shards, whole cache lines plus a line of padding, so no line
+    // is shared by two shards however the array is aligned
+    static constexpr size_t STRIDE = (N_Bins + LINE_COUNTS - 1) / LINE_COUNTS * LINE_COUNTS
+                                     + LINE_COUNTS;
+    // MEMBERS
+    std::atomic<uint32_t> m_counts[N_Shards * STRIDE];
+
+public:
+    // CONSTRUCTORS
+    VlCoverageShards() {
+        for (auto& count : m_counts) count.store(0, std::memory_order_relaxed);
+    }
+    // METHODS
+    void inc(size_t bin) VL_MT_SAFE {
+        m_counts[VerilatedCovShardedCount::threadShard() % N_Shards * STRIDE + bin].fetch_add(
+            1, std::memory_order_relaxed);
+    }
+    VerilatedCovShardedCount countp(size_t bin) VL_MT_SAFE {
+        return VerilatedCovShardedCount{&m_counts[bin], STRIDE, N_Shards};
+    }
+};
+
 //=============================================================================
 /// Insert an item for coverage analysis.
 /// The first argument is a pointer to the count to be dumped.
@@ -111,6 +160,7 @@ public:
     // _insert1: Remember item pointer with count.  (Not const, as may add zeroing function)
     void _inserti(uint32_t* itemp) VL_MT_SAFE;
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
+    void _inserti(const VerilatedCovShardedCount& item) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
     // _insert3: Set parameters
@@ -24,7 +24,12 @@
 
 #include "verilatedos.h"
 
+#include <cstring>
+#include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 //=============================================================================
 // Data used to edit below file, using vlcovgen
@@ -82,4 +87,153 @@ public:
     }
 };
 
+//=============================================================================
+// VerilatedCovBinary
+// Namespace-style static class for \internal use.
+// Binary coverage file format, shared by the runtime writer and verilator_coverage.
+//
+// Each point name is a list of \001<key>\002<value> pairs, as in the text
+// format; the binary format stores each unique key and value string once.
+// All integers are little endian, and every section starts 8-byte aligned:
+//   char     magic[8]              "#VLCOVB1"
+//   uint64   numStrings, stringBytes, numPairs, numPoints
+//   uint64   stringOffsets[numStrings + 1]    Offsets into stringData
+//   char     stringData[stringBytes]
+//   uint32   pairs[numPairs][2]               Key string, value string
+//   uint64   points[numPoints][2]             Count, first pair << 32 | number of pairs
+
+class VerilatedCovBinary final {
+    static void putU64(std::string& out, uint64_t value) {
+        for (int i = 0; i < 8; ++i) out += static_cast<char>((value >> (i * 8)) & 0xff);
+    }
+    static void putU32(std::string& out, uint32_t value) {
+        for (int i = 0; i < 4; ++i) out += static_cast<char>((value >> (i * 8)) & 0xff);
+    }
+    static void putPad(std::string& out) {
+        while (out.size() & 7) out += '\0';
+    }
+    static uint64_t getU64(const char* p) {
+        uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) value = (value << 8) | static_cast<uint8_t>(p[i]);
+        return value;
+    }
+    static uint32_t getU32(const char* p) {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) value = (value << 8) | static_cast<uint8_t>(p[i]);
+        return value;
+    }
+    static uint64_t padded(uint64_t size) { return (size + 7) & ~7ULL; }
+
+public:
+    static const char* magic() VL_PURE { return "#VLCOVB1"; }
+    static constexpr size_t MAGIC_LEN = 8;
+
+    // Return if the data starts with the binary format magic
+    static bool isBinary(const char* datap, size_t size) VL_PURE {
+        return size >= MAGIC_LEN && 0 == std::memcmp(datap, magic(), MAGIC_LEN);
+    }
+
+    // Write points, as (name, count) pairs in text format naming, to the stream
+    static void write(std::ostream& os,
+                      const std::vector<std::pair<const std::string*, uint64_t>>& points) {
+        std::unordered_map<std::string, uint32_t> stringIndexes;
+        std::string stringData;
+        std::string offsets;
+        uint64_t numStrings = 0;
+        const auto intern = [&](const char* bp, const char* ep) -> uint32_t {
+            const auto pair = stringIndexes.emplace(std::string{bp, ep}, numStrings);
+            if (pair.second) {
+                putU64(offsets, stringData.size());
+                stringData.append(bp, ep);
+                ++numStrings;
+            }
+            return pair.first->second;
+        };
+        std::string pairs;
+        std::string pointData;
+        uint64_t numPairs = 0;
+        for (const auto& it : points) {
+            const uint64_t firstPair = numPairs;
+            const char* cp = it.first->c_str();
+            while (*cp == '\001') {
+                const char* const keyp = cp + 1;
+                const char* keyEndp = keyp;
+                while (*keyEndp && *keyEndp != '\002') ++keyEndp;
+                const char* const valp = *keyEndp ? keyEndp + 1 : keyEndp;
+                const char* valEndp = valp;
+                while (*valEndp && *valEndp != '\001') ++valEndp;
+                putU32(pairs, intern(keyp, keyEndp));
+                putU32(pairs, intern(valp, valEndp));
+                ++numPairs;
+                cp = valEndp;
+            }
+            putU64(pointData, it.second);
+            putU64(pointData, (firstPair << 32ULL) | (numPairs - firstPair));
+        }
+        putU64(offsets, stringData.size());
+        putPad(stringData);
+        putPad(pairs);
+
+        std::string header{magic(), MAGIC_LEN};
+        putU64(header, numStrings);
+        putU64(header, stringData.size());
+        putU64(header, numPairs);
+        putU64(header, points.size());
+        os << header << offsets << stringData << pairs << pointData;
+    }
+
+    // Read points from binary data, calling addPoint(name, count) for each
+    // Returns false if the data is not a valid binary coverage file
+    template <typename T_AddPoint>
+    static bool read(const char* datap, size_t size, T_AddPoint addPoint) {
+        if (!isBinary(datap, size) || size < MAGIC_LEN + 4 * 8) return false;
+        const char* p = datap + MAGIC_LEN;
+        const uint64_t numStrings = getU64(p);
+        const uint64_t stringBytes = getU64(p + 8);
+        const uint64_t numPairs = getU64(p + 16);
+        const uint64_t numPoints = getU64(p + 24);
+        p += 32;
+        // Check sizes before multiplying, so corrupt counts cannot overflow
+        const uint64_t remain = size - (p - datap);
+        if (numStrings >= remain / 8 || stringBytes > remain || numPairs > remain / 8
+            || numPoints > remain / 16)
+            return false;
+        const uint64_t need = (numStrings + 1) * 8 + padded(stringBytes) + padded(numPairs * 8)
+                              + numPoints * 16;
+        if (need != remain) return false;
+        const char* const offsetsp = p;
+        const char* const stringsp = offsetsp + (numStrings + 1) * 8;
+        const char* const pairsp = stringsp + padded(stringBytes);
+        const char* const pointsp = pairsp + padded(numPairs * 8);
+        std::vector<std::pair<const char*, size_t>> strings;
+        strings.reserve(numStrings);
+        for (uint64_t i = 0; i < numStrings; ++i) {
+            const uint64_t start = getU64(offsetsp + i * 8);
+            const uint64_t end = getU64(offsetsp + (i + 1) * 8);
+            if (start > end || end > stringBytes) return false;
+            strings.emplace_back(stringsp + start, end - start);
+        }
+        std::string name;
+        for (uint64_t i = 0; i < numPoints; ++i) {
+            const uint64_t count = getU64(pointsp + i * 16);
+            const uint64_t pairInfo = getU64(pointsp + i * 16 + 8);
+            const uint64_t firstPair = pairInfo >> 32ULL;
+            const uint64_t pointPairs = pairInfo & 0xffffffffULL;
+            if (firstPair + pointPairs > numPairs) return false;
+            name.clear();
+            for (uint64_t n = firstPair; n < firstPair + pointPairs; ++n) {
+                const uint32_t key = getU32(pairsp + n * 8);
+                const uint32_t val = getU32(pairsp + n * 8 + 4);
+                if (key >= numStrings || val >= numStrings) return false;
+                name += '\001';
+                name.append(strings[key].first, strings[key].second);
+                name += '\002';
+                name.append(strings[val].first, strings[val].second);
+            }
+            addPoint(name, count);
+        }
+        return true;
+    }
+};
+
 #endif  // guard
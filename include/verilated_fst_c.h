@@ -34,6 +34,13 @@ typedef uint32_t vlFstEnumHandle;
 
 class VerilatedFstBuffer;
 
+// Compression of FST value change blocks, see VerilatedFstC::packType
+enum class VerilatedFstPackType : uint8_t {
+    LZ4,  // LZ4, the default
+    FASTLZ,  // FastLZ
+    ZLIB  // zlib, slowest with smallest files
+};
+
 //=============================================================================
 // VerilatedFst
 // Base class to create a Verilator FST dump
@@ -56,6 +63,10 @@ private:
     char* m_strbufp = nullptr;  // String buffer long enough to hold maxBits() chars
 
     bool m_useFstWriterThread = false;  // Whether to use the separate FST writer thread
+    bool m_parallel = false;  // Compress value change blocks on a separate thread
+    VerilatedFstPackType m_packType = VerilatedFstPackType::LZ4;  // Block compression
+    uint64_t m_blockSize = 0;  // Value change bytes per block, 0 for FST default
+    uint64_t m_blockBytes = 0;  // Estimated value change bytes in the current block
 
     // Prefixes to add to signal names/scope types
     std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
@@ -103,6 +114,15 @@ public:
     // Return if file is open
     bool isOpen() const VL_MT_SAFE { return m_fst != nullptr; }
 
+    // ACCESSORS - Must be called before open()
+    // Set compression of value change blocks
+    void packType(VerilatedFstPackType type) VL_MT_SAFE { m_packType = type; }
+    // Set value change bytes buffered before a block is compressed, 0 for FST default
+    // Approximate, and only makes blocks smaller than the FST default
+    void blockSize(uint64_t bytes) VL_MT_SAFE { m_blockSize = bytes; }
+    // Compress each value change block on a separate thread
+    void parallel(bool flag) VL_MT_SAFE { m_parallel = flag; }
+
     //=========================================================================
     // Internal interface to Verilator generated code
 
@@ -185,6 +205,9 @@ class VerilatedFstBuffer VL_NOT_FINAL {
     VL_ATTR_ALWINLINE void emitQData(uint32_t code, QData newval, int bits);
     VL_ATTR_ALWINLINE void emitWData(uint32_t code, const WData* newvalp, int bits);
     VL_ATTR_ALWINLINE void emitDouble(uint32_t code, double newval);
+
+    // Add a value change to the owner's estimate of the block size
+    void countChange(int bits) { m_owner.m_blockBytes += VL_BYTES_I(bits) + 5; }
 };
 
 //=============================================================================
@@ -211,6 +234,20 @@ public:
     bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
     /// Open a new FST file
     virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    /// Set compression of value change blocks; LZ4 is fastest, ZLIB
+    /// makes the smallest files. Must be called before open().
+    void packType(VerilatedFstPackType type) VL_MT_SAFE { m_sptrace.packType(type); }
+    /// Set bytes of value changes buffered before each block is compressed
+    /// and written. Larger blocks compress better but need more memory.
+    /// The size is approximate, as a block ends at the next time change
+    /// once this is reached, and sizes above the FST library default of
+    /// 128 MB have no effect. Zero selects the FST library default.
+    /// Must be called before open().
+    void blockSize(uint64_t bytes) VL_MT_SAFE { m_sptrace.blockSize(bytes); }
+    /// Compress each block on a separate thread while the model continues
+    /// into the next block. Implied by --trace-threads 2 or more.
+    /// Must be called before open().
+    void parallel(bool flag) VL_MT_SAFE { m_sptrace.parallel(flag); }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
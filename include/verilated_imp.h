@@ -207,6 +207,10 @@ protected:
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
     mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Incremented on every m_nameMap change of any context, so lookup caches know to
+    // flush. Process wide, so a new context at a freed context's address never
+    // repeats a generation seen before.
+    static std::atomic<uint64_t> s_nameMapGeneration;
 };
 
 //======================================================================
@@ -269,6 +273,9 @@ public:  // But only for verilated*.cpp
     // METHODS - scope name - INTERNAL only for verilated*.cpp
     void scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE;
     void scopeErase(const VerilatedScope* scopep) VL_MT_SAFE;
+    uint64_t scopeNameMapGeneration() const VL_MT_SAFE {
+        return VerilatedContextImpData::s_nameMapGeneration.load(std::memory_order_acquire);
+    }
 
     // METHODS - file IO - INTERNAL only for verilated*.cpp
 
@@ -22,7 +22,10 @@
 
 #include "verilated_random.h"
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <streambuf>
 
@@ -394,55 +397,834 @@ void VlRandomizer::randomConstraint(std::ostream& os, VlRNG& rngr, int bits) {
     os << ')';
 }
 
-bool VlRandomizer::next(VlRNG& rngr) {
-    if (m_vars.empty()) return true;
-    std::iostream& f = getSolver();
-    if (!f) return false;
+//======================================================================
+// VlNativeSolver: built-in solver for simple constraints
+//
+// Constraints over scalar variables of at most 64 bits that use only operators this class can
+// evaluate are solved without the SMT solver process. Comparisons of one variable against
+// constants (ranges, inside sets, dist items) give the set of values the variable is drawn
+// from, equalities compute a variable from others, and any other constraint is checked on the
+// drawn values. If no draw satisfies all constraints, the caller falls back to the SMT solver.
 
-    f << "(set-option :produce-models true)\n";
-    f << "(set-logic QF_ABV)\n";
-    f << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
-    f << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
-    for (const auto& var : m_vars) {
-        f << "(declare-fun " << var.second->name() << " () ";
-        var.second->emitType(f);
-        f << ")\n";
+class VlNativeSolver final {
+public:
+    enum Result : uint8_t { SOLVED, UNSAT, UNKNOWN };
+
+private:
+    // TYPES
+    enum Op : uint8_t {
+        CONST,
+        VAR,
+        NOT,
+        NEG,
+        AND,
+        OR,
+        XOR,
+        ADD,
+        SUB,
+        MUL,
+        UDIV,
+        UREM,
+        SHL,
+        LSHR,
+        ASHR,
+        EQ,
+        ULT,
+        ULE,
+        SLT,
+        SLE,
+        ITE,
+        CONCAT,
+        EXTRACT,
+        ZEXT,
+        SEXT
+    };
+    struct Node final {
+        Op m_op;
+        int m_width;  // Result width in bits
+        uint64_t m_value;  // CONST: value, VAR: variable index, EXTRACT: low bit
+        int m_lhsi;  // Operand node indices, or -1
+        int m_rhsi;
+        int m_thsi;
+    };
+    using Ranges = std::vector<std::pair<uint64_t, uint64_t>>;  // Sorted disjoint [lo, hi]
+    struct Var final {
+        const VlRandomVar* m_varp;  // Variable to set
+        bool m_rand;  // Randomized, false if rand_mode is off
+        Ranges m_ranges;  // Values allowed by constraints on this variable alone
+        int m_defi = -1;  // Node the variable is computed from, or -1 if drawn
+    };
+    struct Domain final {
+        int m_vari = -1;  // Variable index, or -1 if the expression is constant
+        bool m_true = false;  // Constant value, if no variable
+        Ranges m_ranges;  // Values of the variable satisfying the expression
+    };
+
+    // MEMBERS
+    std::vector<Node> m_nodes;  // Parsed expressions
+    std::vector<Var> m_vars;  // Variables
+    std::map<std::string, int> m_varIdxs;  // Variable name to index in m_vars
+    std::vector<int> m_checks;  // Constraints checked on drawn values
+    std::vector<int> m_orders;  // Checked comparisons between two variables
+    std::vector<int> m_defOrder;  // Computed variables, in order of evaluation
+    std::vector<uint64_t> m_values;  // Current value of each variable
+    const char* m_textp = nullptr;  // Constraint text being parsed
+    bool m_unsat = false;  // A constraint is always false
+
+    // METHODS
+    static uint64_t mask(int width) { return width >= 64 ? ~0ULL : (1ULL << width) - 1; }
+    static int64_t toSigned(uint64_t value, int width) {
+        return width >= 64 ? static_cast<int64_t>(value)
+                           : static_cast<int64_t>(value << (64 - width)) >> (64 - width);
     }
-    for (const std::string& constraint : m_constraints) {
-        f << "(assert (= #b1 " << constraint << "))\n";
+    int addNode(Op op, int width, int lhsi = -1, int rhsi = -1, int thsi = -1,
+                uint64_t value = 0) {
+        if (width < 1 || width > 64) return -1;
+        m_nodes.push_back(Node{op, width, value, lhsi, rhsi, thsi});
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+    int width(int nodei) const { return m_nodes[nodei].m_width; }
+
+    // Parsing SMT-LIB2 text as emitted by V3Randomize. Returns -1 if unsupported.
+    std::string token() {
+        while (std::isspace(static_cast<unsigned char>(*m_textp))) ++m_textp;
+        const char* const startp = m_textp;
+        if (*m_textp == '(' || *m_textp == ')') return std::string(1, *m_textp++);
+        while (*m_textp && *m_textp != '(' && *m_textp != ')'
+               && !std::isspace(static_cast<unsigned char>(*m_textp))) {
+            ++m_textp;
+        }
+        return std::string(startp, m_textp);
+    }
+    bool expect(const char* tokp) { return token() == tokp; }
+    static bool parseIndex(const std::string& tok, int& value) {
+        if (tok.empty() || tok.size() > 9) return false;
+        for (const char c : tok) {
+            if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+        }
+        value = std::atoi(tok.c_str());
+        return true;
+    }
+    int parseAtom(const std::string& tok) {
+        if (tok == "true" || tok == "false") return addNode(CONST, 1, -1, -1, -1, tok == "true");
+        if (tok.size() > 2 && tok[0] == '#' && (tok[1] == 'b' || tok[1] == 'x')) {
+            const int bitsPerDigit = tok[1] == 'b' ? 1 : 4;
+            const int width = bitsPerDigit * (tok.size() - 2);
+            if (width > 64) return -1;
+            uint64_t value = 0;
+            for (size_t i = 2; i < tok.size(); ++i) {
+                const char c = std::tolower(static_cast<unsigned char>(tok[i]));
+                int digit;
+                if (c >= '0' && c <= '9') {
+                    digit = c - '0';
+                } else if (c >= 'a' && c <= 'f') {
+                    digit = c - 'a' + 10;
+                } else {
+                    return -1;
+                }
+                if (digit >> bitsPerDigit) return -1;
+                value = (value << bitsPerDigit) | digit;
+            }
+            return addNode(CONST, width, -1, -1, -1, value);
+        }
+        const auto it = m_varIdxs.find(tok);
+        if (it == m_varIdxs.end()) return -1;
+        return addNode(VAR, m_vars[it->second].m_varp->width(), -1, -1, -1, it->second);
+    }
+    int parseIndexed() {
+        // After "((_ ", parse "name index...) operand)"
+        const std::string name = token();
+        int index[2];
+        int nindex = 0;
+        for (std::string tok = token(); tok != ")"; tok = token()) {
+            if (nindex == 2 || !parseIndex(tok, index[nindex++])) return -1;
+        }
+        const int argi = parse();
+        if (argi < 0 || !expect(")")) return -1;
+        const int argWidth = width(argi);
+        if (name == "extract" && nindex == 2) {
+            if (index[1] > index[0] || index[0] >= argWidth) return -1;
+            return addNode(EXTRACT, index[0] - index[1] + 1, argi, -1, -1, index[1]);
+        }
+        if (name == "zero_extend" && nindex == 1) {
+            if (index[0] == 0) return argi;
+            return addNode(ZEXT, argWidth + index[0], argi);
+        }
+        if (name == "sign_extend" && nindex == 1) {
+            if (index[0] == 0) return argi;
+            return addNode(SEXT, argWidth + index[0], argi);
+        }
+        if (name == "repeat" && nindex == 1 && index[0] > 0) {
+            int resulti = argi;
+            for (int i = 1; i < index[0] && resulti >= 0; ++i) {
+                resulti = addNode(CONCAT, width(resulti) + argWidth, resulti, argi);
+            }
+            return resulti;
+        }
+        return -1;
+    }
+    int parse() {
+        const std::string tok = token();
+        if (tok == ")" || tok.empty()) return -1;
+        if (tok != "(") return parseAtom(tok);
+        const std::string name = token();
+        if (name == ")") return -1;
+        if (name == "(") {
+            if (!expect("_")) return -1;
+            return parseIndexed();
+        }
+        std::vector<int> args;
+        while (true) {
+            while (std::isspace(static_cast<unsigned char>(*m_textp))) ++m_textp;
+            if (*m_textp == ')') break;
+            const int argi = parse();
+            if (argi < 0) return -1;
+            args.push_back(argi);
+        }
+        ++m_textp;
+        if (args.empty()) return -1;
+        const int lhsi = args[0];
+        const int lwidth = width(lhsi);
+        if (name == "__Vbv" || name == "__Vbool") return args.size() == 1 ? lhsi : -1;
+        if (args.size() == 1) {
+            if (name == "not" || name == "bvnot") return addNode(NOT, lwidth, lhsi);
+            if (name == "bvneg") return addNode(NEG, lwidth, lhsi);
+            return -1;
+        }
+        if (name == "ite") {
+            if (args.size() != 3 || lwidth != 1 || width(args[1]) != width(args[2])) return -1;
+            return addNode(ITE, width(args[1]), lhsi, args[1], args[2]);
+        }
+        if (name == "concat") {
+            int resulti = lhsi;
+            for (size_t i = 1; i < args.size() && resulti >= 0; ++i) {
+                resulti = addNode(CONCAT, width(resulti) + width(args[i]), resulti, args[i]);
+            }
+            return resulti;
+        }
+        for (const int argi : args) {
+            if (width(argi) != lwidth) return -1;
+        }
+        Op op;
+        bool swap = false;  // Operands swapped, for the greater-than comparisons
+        if (name == "and" || name == "bvand") {
+            op = AND;
+        } else if (name == "or" || name == "bvor") {
+            op = OR;
+        } else if (name == "xor" || name == "bvxor") {
+            op = XOR;
+        } else if (name == "bvadd") {
+            op = ADD;
+        } else if (name == "bvmul") {
+            op = MUL;
+        } else if (args.size() != 2) {
+            return -1;
+        } else if (name == "=>") {
+            return addNode(OR, 1, addNode(NOT, 1, lhsi), args[1]);
+        } else if (name == "=") {
+            return addNode(EQ, 1, lhsi, args[1]);
+        } else if (name == "bvsub") {
+            op = SUB;
+        } else if (name == "bvudiv") {
+            op = UDIV;
+        } else if (name == "bvurem") {
+            op = UREM;
+        } else if (name == "bvshl") {
+            op = SHL;
+        } else if (name == "bvlshr") {
+            op = LSHR;
+        } else if (name == "bvashr") {
+            op = ASHR;
+        } else if (name == "bvult" || name == "bvugt") {
+            op = ULT;
+            swap = name == "bvugt";
+        } else if (name == "bvule" || name == "bvuge") {
+            op = ULE;
+            swap = name == "bvuge";
+        } else if (name == "bvslt" || name == "bvsgt") {
+            op = SLT;
+            swap = name == "bvsgt";
+        } else if (name == "bvsle" || name == "bvsge") {
+            op = SLE;
+            swap = name == "bvsge";
+        } else {
+            return -1;
+        }
+        if (op == ULT || op == ULE || op == SLT || op == SLE) {
+            return swap ? addNode(op, 1, args[1], lhsi) : addNode(op, 1, lhsi, args[1]);
+        }
+        int resulti = lhsi;
+        for (size_t i = 1; i < args.size(); ++i) resulti = addNode(op, lwidth, resulti, args[i]);
+        return resulti;
     }
-    f << "(check-sat)\n";
 
-    bool sat = parseSolution(f);
-    if (!sat) {
-        f << "(reset)\n";
+    // Evaluation with the current variable values
+    uint64_t eval(int nodei) const {
+        const Node& node = m_nodes[nodei];
+        const int w = node.m_width;
+        switch (node.m_op) {
+        case CONST: return node.m_value;
+        case VAR: return m_values[node.m_value];
+        case NOT: return ~eval(node.m_lhsi) & mask(w);
+        case NEG: return (0 - eval(node.m_lhsi)) & mask(w);
+        case ITE: return eval(node.m_lhsi) ? eval(node.m_rhsi) : eval(node.m_thsi);
+        case EXTRACT: return (eval(node.m_lhsi) >> node.m_value) & mask(w);
+        case ZEXT: return eval(node.m_lhsi);
+        case SEXT:
+            return static_cast<uint64_t>(toSigned(eval(node.m_lhsi), width(node.m_lhsi)))
+                   & mask(w);
+        default: break;
+        }
+        const uint64_t lhs = eval(node.m_lhsi);
+        const uint64_t rhs = eval(node.m_rhsi);
+        const int lw = width(node.m_lhsi);
+        switch (node.m_op) {
+        case AND: return lhs & rhs;
+        case OR: return lhs | rhs;
+        case XOR: return lhs ^ rhs;
+        case ADD: return (lhs + rhs) & mask(w);
+        case SUB: return (lhs - rhs) & mask(w);
+        case MUL: return (lhs * rhs) & mask(w);
+        case UDIV: return rhs ? lhs / rhs : mask(w);
+        case UREM: return rhs ? lhs % rhs : lhs;
+        case SHL: return rhs >= static_cast<uint64_t>(w) ? 0 : (lhs << rhs) & mask(w);
+        case LSHR: return rhs >= static_cast<uint64_t>(w) ? 0 : lhs >> rhs;
+        case ASHR:
+            return static_cast<uint64_t>(toSigned(lhs, w) >> std::min<uint64_t>(rhs, 63))
+                   & mask(w);
+        case EQ: return lhs == rhs;
+        case ULT: return lhs < rhs;
+        case ULE: return lhs <= rhs;
+        case SLT: return toSigned(lhs, lw) < toSigned(rhs, lw);
+        case SLE: return toSigned(lhs, lw) <= toSigned(rhs, lw);
+        case CONCAT: return (lhs << width(node.m_rhsi)) | rhs;
+        default: return 0;  // LCOV_EXCL_LINE
+        }
+    }
+    void nodeVars(int nodei, std::set<int>& varis) const {
+        const Node& node = m_nodes[nodei];
+        if (node.m_op == VAR) varis.insert(static_cast<int>(node.m_value));
+        if (node.m_lhsi >= 0) nodeVars(node.m_lhsi, varis);
+        if (node.m_rhsi >= 0) nodeVars(node.m_rhsi, varis);
+        if (node.m_thsi >= 0) nodeVars(node.m_thsi, varis);
+    }
+
+    // Value sets
+    static Ranges normalize(Ranges ranges) {
+        std::sort(ranges.begin(), ranges.end());
+        Ranges result;
+        for (const auto& range : ranges) {
+            if (!result.empty()
+                && (result.back().second == ~0ULL || range.first <= result.back().second + 1)) {
+                result.back().second = std::max(result.back().second, range.second);
+            } else {
+                result.push_back(range);
+            }
+        }
+        return result;
+    }
+    static Ranges intersect(const Ranges& a, const Ranges& b) {
+        Ranges result;
+        for (const auto& ra : a) {
+            for (const auto& rb : b) {
+                const uint64_t lo = std::max(ra.first, rb.first);
+                const uint64_t hi = std::min(ra.second, rb.second);
+                if (lo <= hi) result.emplace_back(lo, hi);
+            }
+        }
+        return normalize(result);
+    }
+    static Ranges unite(const Ranges& a, const Ranges& b) {
+        Ranges result{a};
+        result.insert(result.end(), b.begin(), b.end());
+        return normalize(result);
+    }
+    static Ranges complement(const Ranges& ranges, int width) {
+        Ranges result;
+        uint64_t lo = 0;
+        for (const auto& range : ranges) {
+            if (range.first > lo) result.emplace_back(lo, range.first - 1);
+            if (range.second == mask(width)) return result;
+            lo = range.second + 1;
+        }
+        result.emplace_back(lo, mask(width));
+        return result;
+    }
+    static Ranges shift(const Ranges& ranges, uint64_t lo, uint64_t hi, uint64_t sub) {
+        // Values in [lo, hi] moved down by sub
+        Ranges result = intersect(ranges, Ranges{{lo, hi}});
+        for (auto& range : result) {
+            range.first -= sub;
+            range.second -= sub;
+        }
+        return result;
+    }
+    static bool contains(const Ranges& ranges, uint64_t value) {
+        for (const auto& range : ranges) {
+            if (value >= range.first && value <= range.second) return true;
+        }
         return false;
     }
-    for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL && sat; i++) {
-        f << "(assert ";
-        randomConstraint(f, rngr, _VL_SOLVER_HASH_LEN);
-        f << ")\n";
-        f << "\n(check-sat)\n";
-        sat = parseSolution(f);
+    uint64_t draw(const Ranges& ranges, VlRNG& rngr) const {
+        if (ranges.size() == 1 && ranges[0].first == 0 && ranges[0].second == ~0ULL) {
+            return VL_RANDOM_RNG_Q(rngr);
+        }
+        uint64_t total = 0;
+        for (const auto& range : ranges) total += range.second - range.first + 1;
+        uint64_t pick = VL_RANDOM_RNG_Q(rngr) % total;
+        for (const auto& range : ranges) {
+            if (pick <= range.second - range.first) return range.first + pick;
+            pick -= range.second - range.first + 1;
+        }
+        return 0;  // LCOV_EXCL_LINE
     }
 
-    f << "(reset)\n";
-    return true;
+    // Domain of a comparison between a variable (possibly extended) and a constant
+    bool compareDomain(Op op, int termi, int consti, bool termLeft, Domain& domain) const {
+        std::set<int> varis;
+        nodeVars(consti, varis);
+        if (!varis.empty()) return false;
+        const Node& term = m_nodes[termi];
+        const Node* varp = &term;
+        if (term.m_op == ZEXT || term.m_op == SEXT) varp = &m_nodes[term.m_lhsi];
+        if (varp->m_op != VAR) return false;
+        if (term.m_op == SEXT && op != EQ && op != SLT && op != SLE) return false;
+        if (term.m_op == ZEXT && (op == SLT || op == SLE)) return false;
+        const int w = term.m_width;
+        const bool isSigned = op == SLT || op == SLE;
+        const uint64_t signBit = 1ULL << (w - 1);
+        uint64_t value = eval(consti);
+        if (isSigned) value ^= signBit;
+        const bool strict = op == ULT || op == SLT;
+        Ranges ranges;
+        if (op == EQ) {
+            ranges.emplace_back(value, value);
+        } else if (termLeft) {  // term < value
+            if (!strict) {
+                ranges.emplace_back(0, value);
+            } else if (value) {
+                ranges.emplace_back(0, value - 1);
+            }
+        } else {  // value < term
+            if (!strict) {
+                ranges.emplace_back(value, mask(w));
+            } else if (value != mask(w)) {
+                ranges.emplace_back(value + 1, mask(w));
+            }
+        }
+        if (isSigned) {
+            // Flip the sign bit back: ranges above and below it swap places
+            ranges = unite(shift(ranges, signBit, mask(w), signBit),
+                           shift(ranges, 0, signBit - 1, 0 - signBit));
+        }
+        const int vw = varp->m_width;
+        if (term.m_op == ZEXT) {
+            ranges = intersect(ranges, Ranges{{0, mask(vw)}});
+        } else if (term.m_op == SEXT) {
+            const uint64_t half = mask(vw - 1);
+            ranges = unite(intersect(ranges, Ranges{{0, half}}),
+                           shift(ranges, mask(w) - half, mask(w), mask(w) - mask(vw)));
+        }
+        domain.m_vari = static_cast<int>(varp->m_value);
+        domain.m_ranges = std::move(ranges);
+        return true;
+    }
+    // Set of values satisfying a Boolean expression over at most one variable
+    bool domainOf(int nodei, Domain& domain) const {
+        const Node& node = m_nodes[nodei];
+        if (node.m_width != 1) return false;
+        switch (node.m_op) {
+        case CONST: domain.m_true = node.m_value; return true;
+        case VAR: {
+            domain.m_vari = static_cast<int>(node.m_value);
+            domain.m_ranges = Ranges{{1, 1}};
+            return true;
+        }
+        case NOT: {
+            if (!domainOf(node.m_lhsi, domain)) return false;
+            if (domain.m_vari < 0) {
+                domain.m_true = !domain.m_true;
+            } else {
+                domain.m_ranges
+                    = complement(domain.m_ranges, m_vars[domain.m_vari].m_varp->width());
+            }
+            return true;
+        }
+        case AND:
+        case OR: {
+            Domain rhs;
+            if (!domainOf(node.m_lhsi, domain) || !domainOf(node.m_rhsi, rhs)) {
+                return false;
+            }
+            const bool isAnd = node.m_op == AND;
+            if (rhs.m_vari < 0) {
+                if (rhs.m_true != isAnd) domain = rhs;  // Absorbing constant
+                return true;
+            }
+            if (domain.m_vari < 0) {
+                if (domain.m_true == isAnd) domain = rhs;
+                return true;
+            }
+            if (domain.m_vari != rhs.m_vari) return false;
+            domain.m_ranges = isAnd ? intersect(domain.m_ranges, rhs.m_ranges)
+                                    : unite(domain.m_ranges, rhs.m_ranges);
+            return true;
+        }
+        case EQ:
+        case ULT:
+        case ULE:
+        case SLT:
+        case SLE: {
+            if (compareDomain(node.m_op, node.m_lhsi, node.m_rhsi, true, domain)) return true;
+            if (compareDomain(node.m_op, node.m_rhsi, node.m_lhsi, false, domain)) return true;
+            return false;
+        }
+        default: return false;
+        }
+    }
+
+    bool addConstraint(const std::string& constraint) {
+        m_textp = constraint.c_str();
+        const int rooti = parse();
+        if (rooti < 0 || width(rooti) != 1 || !token().empty()) return false;
+        std::vector<int> conjuncts{rooti};
+        while (!conjuncts.empty()) {
+            const int nodei = conjuncts.back();
+            conjuncts.pop_back();
+            const Node& node = m_nodes[nodei];
+            if (node.m_op == AND) {
+                conjuncts.push_back(node.m_lhsi);
+                conjuncts.push_back(node.m_rhsi);
+                continue;
+            }
+            Domain domain;
+            if (domainOf(nodei, domain)) {
+                if (domain.m_vari < 0) {
+                    if (!domain.m_true) m_unsat = true;
+                } else {
+                    Var& var = m_vars[domain.m_vari];
+                    var.m_ranges = intersect(var.m_ranges, domain.m_ranges);
+                }
+                continue;
+            }
+            m_checks.push_back(nodei);
+            if ((node.m_op == ULT || node.m_op == ULE) && m_nodes[node.m_lhsi].m_op == VAR
+                && m_nodes[node.m_rhsi].m_op == VAR) {
+                m_orders.push_back(nodei);
+            }
+            if (node.m_op != EQ) continue;
+            // Equality between a variable and an expression of others defines the variable.
+            // If the variable is zero extended its value is the low bits, and the check fails
+            // on any others.
+            for (int side = 0; side < 2; ++side) {
+                int vari = side ? node.m_rhsi : node.m_lhsi;
+                const int defi = side ? node.m_lhsi : node.m_rhsi;
+                if (m_nodes[vari].m_op == ZEXT) vari = m_nodes[vari].m_lhsi;
+                if (m_nodes[vari].m_op != VAR) continue;
+                Var& var = m_vars[m_nodes[vari].m_value];
+                std::set<int> varis;
+                nodeVars(defi, varis);
+                if (!var.m_rand || var.m_defi >= 0 || varis.count(m_nodes[vari].m_value)) {
+                    continue;
+                }
+                var.m_defi = defi;
+                break;
+            }
+        }
+        return true;
+    }
+    void enumerateChecks() {
+        // Constraints on one variable with few values are applied to its set of values
+        for (auto it = m_checks.begin(); it != m_checks.end();) {
+            std::set<int> varis;
+            nodeVars(*it, varis);
+            if (varis.size() != 1) {
+                ++it;
+                continue;
+            }
+            const int vari = *varis.begin();
+            Var& var = m_vars[vari];
+            uint64_t count = 0;
+            for (const auto& range : var.m_ranges) {
+                count += range.second - range.first + 1;
+                if (count > ENUMERATE || count == 0) break;
+            }
+            if (!var.m_rand || count > ENUMERATE || count == 0) {
+                ++it;
+                continue;
+            }
+            Ranges ranges;
+            for (const auto& range : var.m_ranges) {
+                for (uint64_t value = range.first;; ++value) {
+                    m_values[vari] = value;
+                    if (eval(*it)) {
+                        if (!ranges.empty() && ranges.back().second + 1 == value) {
+                            ranges.back().second = value;
+                        } else {
+                            ranges.emplace_back(value, value);
+                        }
+                    }
+                    if (value == range.second) break;
+                }
+            }
+            var.m_ranges = std::move(ranges);
+            it = m_checks.erase(it);
+        }
+    }
+    void propagateOrders() {
+        // Narrow both sides of comparisons between variables, until no more change
+        for (size_t round = 0; round <= m_orders.size(); ++round) {
+            bool changed = false;
+            for (const int nodei : m_orders) {
+                const Node& node = m_nodes[nodei];
+                Var& lhs = m_vars[m_nodes[node.m_lhsi].m_value];
+                Var& rhs = m_vars[m_nodes[node.m_rhsi].m_value];
+                if (lhs.m_ranges.empty() || rhs.m_ranges.empty()) return;
+                const uint64_t strict = node.m_op == ULT;
+                const size_t lhsSize = lhs.m_ranges.size();
+                const size_t rhsSize = rhs.m_ranges.size();
+                const uint64_t lhsMin = lhs.m_ranges.front().first;
+                const uint64_t lhsMax = lhs.m_ranges.back().second;
+                const uint64_t rhsMin = rhs.m_ranges.front().first;
+                const uint64_t rhsMax = rhs.m_ranges.back().second;
+                // lhs < rhs, so lhs <= max(rhs) - 1, and rhs >= min(lhs) + 1
+                if (rhsMax < strict) {
+                    lhs.m_ranges.clear();
+                } else if (lhsMax > rhsMax - strict) {
+                    lhs.m_ranges = intersect(lhs.m_ranges, Ranges{{0, rhsMax - strict}});
+                }
+                if (lhsMin > mask(rhs.m_varp->width()) - strict) {
+                    rhs.m_ranges.clear();
+                } else if (rhsMin < lhsMin + strict) {
+                    rhs.m_ranges = intersect(rhs.m_ranges,
+                                             Ranges{{lhsMin + strict, mask(rhs.m_varp->width())}});
+                }
+                if (lhs.m_ranges.empty() || rhs.m_ranges.empty()) return;
+                changed |= lhs.m_ranges.size() != lhsSize || rhs.m_ranges.size() != rhsSize
+                           || lhs.m_ranges.back().second != lhsMax
+                           || rhs.m_ranges.front().first != rhsMin;
+            }
+            if (!changed) return;
+        }
+    }
+    void orderDefs() {
+        // Computed variables need the variables they use set first; break any cycles
+        std::vector<bool> known(m_vars.size());
+        for (size_t i = 0; i < m_vars.size(); ++i) known[i] = m_vars[i].m_defi < 0;
+        bool progress = true;
+        while (progress) {
+            progress = false;
+            for (size_t i = 0; i < m_vars.size(); ++i) {
+                if (known[i]) continue;
+                std::set<int> varis;
+                nodeVars(m_vars[i].m_defi, varis);
+                if (std::all_of(varis.begin(), varis.end(), [&](int j) { return known[j]; })) {
+                    known[i] = true;
+                    m_defOrder.push_back(static_cast<int>(i));
+                    progress = true;
+                }
+            }
+        }
+        for (size_t i = 0; i < m_vars.size(); ++i) {
+            if (!known[i]) m_vars[i].m_defi = -1;
+        }
+    }
+    static uint64_t getValue(const VlRandomVar& var) {
+        const void* const datap = var.datap(0);
+        if (var.width() <= VL_BYTESIZE) return *static_cast<const CData*>(datap);
+        if (var.width() <= VL_SHORTSIZE) return *static_cast<const SData*>(datap);
+        if (var.width() <= VL_IDATASIZE) return *static_cast<const IData*>(datap);
+        return *static_cast<const QData*>(datap);
+    }
+    static void setValue(const VlRandomVar& var, uint64_t value) {
+        void* const datap = var.datap(0);
+        if (var.width() <= VL_BYTESIZE) {
+            *static_cast<CData*>(datap) = static_cast<CData>(value);
+        } else if (var.width() <= VL_SHORTSIZE) {
+            *static_cast<SData*>(datap) = static_cast<SData>(value);
+        } else if (var.width() <= VL_IDATASIZE) {
+            *static_cast<IData*>(datap) = static_cast<IData>(value);
+        } else {
+            *static_cast<QData*>(datap) = value;
+        }
+    }
+
+public:
+    // Number of draws before giving up on constraints that are only checked
+    static constexpr int ATTEMPTS = 64;
+    // Largest set of values tested one by one against a constraint on one variable
+    static constexpr uint64_t ENUMERATE = 4096;
+
+    // METHODS
+    Result solve(const std::map<std::string, std::shared_ptr<const VlRandomVar>>& vars,
+                 const VlQueue<CData>* randmodep, const std::vector<std::string>& constraints,
+                 VlRNG& rngr) {
+        for (const auto& it : vars) {
+            const VlRandomVar& var = *it.second;
+            if (!var.isScalar() || var.width() > VL_QUADSIZE) return UNKNOWN;
+            const bool rand = var.randModeIdxNone() || !randmodep
+                              || randmodep->at(var.randModeIdx());
+            m_varIdxs.emplace(it.first, static_cast<int>(m_vars.size()));
+            m_vars.push_back(Var{&var, rand, Ranges{{0, mask(var.width())}}});
+            m_values.push_back(rand ? 0 : getValue(var));
+        }
+        for (const std::string& constraint : constraints) {
+            if (!addConstraint(constraint)) return UNKNOWN;
+        }
+        if (m_unsat) return UNSAT;
+        enumerateChecks();
+        propagateOrders();
+        for (size_t i = 0; i < m_vars.size(); ++i) {
+            const Var& var = m_vars[i];
+            if (var.m_ranges.empty()) return UNSAT;
+            if (!var.m_rand && !contains(var.m_ranges, m_values[i])) return UNSAT;
+        }
+        orderDefs();
+        for (int attempt = 0; attempt < ATTEMPTS; ++attempt) {
+            for (size_t i = 0; i < m_vars.size(); ++i) {
+                const Var& var = m_vars[i];
+                if (var.m_rand && var.m_defi < 0) m_values[i] = draw(var.m_ranges, rngr);
+            }
+            for (const int i : m_defOrder) {
+                m_values[i] = eval(m_vars[i].m_defi) & mask(m_vars[i].m_varp->width());
+            }
+            bool ok = true;
+            for (size_t i = 0; ok && i < m_vars.size(); ++i) {
+                ok = contains(m_vars[i].m_ranges, m_values[i]);
+            }
+            for (size_t i = 0; ok && i < m_checks.size(); ++i) {
+                ok = eval(m_checks[i]);
+            }
+            if (!ok) continue;
+            for (size_t i = 0; i < m_vars.size(); ++i) {
+                if (m_vars[i].m_rand) setValue(*m_vars[i].m_varp, m_values[i]);
+            }
+            return SOLVED;
+        }
+        return UNKNOWN;
+    }
+};
+
+// State of the solver process, which is shared by all VlRandomizers. Above the setup commands,
+// the solver keeps a frame with the variable declarations of the last randomizer, and the
+// constraints that its last calls had in common, which are likely static. Each next() pushes a
+// frame with the remaining constraints over that, and pops it when done.
+struct VlSolverSession final {
+    bool m_setup = false;  // Options, logic and helper functions sent
+    bool m_frameOpen = false;  // Declaration frame pushed
+    std::string m_decls;  // Declarations in the declaration frame
+    std::set<std::string> m_frameConstraints;  // Constraints asserted in the declaration frame
+    std::set<std::string> m_lastConstraints;  // Constraints of the last next()
+};
+
+static VlSolverSession& getSolverSession() {
+    static VlSolverSession s_session;
+    return s_session;
 }
 
-bool VlRandomizer::parseSolution(std::iostream& f) {
+static bool checkSat(std::iostream& f) {
     std::string sat;
-    do { std::getline(f, sat); } while (sat == "");
-
-    if (sat == "unsat") return false;
-    if (sat != "sat") {
+    do { std::getline(f, sat); } while (sat == "" && f);
+    if (sat == "sat") return true;
+    if (sat != "unsat") {
         std::stringstream msg;
         msg << "Internal: Solver error: " << sat;
         const std::string str = msg.str();
         VL_WARN_MT(__FILE__, __LINE__, "randomize", str.c_str());
-        return false;
     }
+    return false;
+}
+
+static void emitCheckSatAssuming(std::ostream& f, int nhash) {
+    f << "(check-sat-assuming (";
+    for (int i = 0; i < nhash; i++) f << " __Vhash" << i;
+    f << "))\n";
+}
 
+bool VlRandomizer::next(VlRNG& rngr) {
+    if (m_vars.empty()) return true;
+    // Simple constraints are solved without the solver process
+    switch (VlNativeSolver{}.solve(m_vars, m_randmode, m_constraints, rngr)) {
+    case VlNativeSolver::SOLVED: return true;
+    case VlNativeSolver::UNSAT: return false;
+    default: break;
+    }
+    std::iostream& f = getSolver();
+    if (!f) return false;
+    VlSolverSession& session = getSolverSession();
+
+    if (!session.m_setup) {
+        session.m_setup = true;
+        f << "(set-option :produce-models true)\n";
+        f << "(set-logic QF_ABV)\n";
+        f << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
+        f << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+    }
+
+    // Reuse the declaration frame if it declares the same variables, and has no constraints
+    // that are not wanted now
+    std::ostringstream declss;
+    for (const auto& var : m_vars) {
+        declss << "(declare-fun " << var.second->name() << " () ";
+        var.second->emitType(declss);
+        declss << ")\n";
+    }
+    const std::string decls = declss.str();
+    std::set<std::string> constraints{m_constraints.begin(), m_constraints.end()};
+    if (!session.m_frameOpen || decls != session.m_decls
+        || !std::includes(constraints.begin(), constraints.end(),
+                          session.m_frameConstraints.begin(),
+                          session.m_frameConstraints.end())) {
+        if (session.m_frameOpen) f << "(pop 1)\n";
+        f << "(push 1)\n";
+        f << decls;
+        session.m_frameOpen = true;
+        session.m_decls = decls;
+        session.m_frameConstraints.clear();
+        session.m_lastConstraints.clear();
+    }
+    // Constraints also in the last call are likely static, so keep them in the frame
+    for (const std::string& constraint : constraints) {
+        if (session.m_lastConstraints.count(constraint)
+            && session.m_frameConstraints.insert(constraint).second) {
+            f << "(assert (= #b1 " << constraint << "))\n";
+        }
+    }
+
+    f << "(push 1)\n";
+    for (const std::string& constraint : constraints) {
+        if (!session.m_frameConstraints.count(constraint)) {
+            f << "(assert (= #b1 " << constraint << "))\n";
+        }
+    }
+    session.m_lastConstraints = std::move(constraints);
+    // Random constraints to pick among solutions, named so they can be assumed
+    for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL; i++) {
+        f << "(declare-fun __Vhash" << i << " () Bool)\n";
+        f << "(assert (= __Vhash" << i << ' ';
+        randomConstraint(f, rngr, _VL_SOLVER_HASH_LEN);
+        f << "))\n";
+    }
+    // Check without, then with increasingly many random constraints, in one round trip
+    f << "(check-sat)\n";
+    for (int i = 1; i <= _VL_SOLVER_HASH_LEN_TOTAL; i++) emitCheckSatAssuming(f, i);
+    int nsat = 0;  // Satisfiable checks before the first unsatisfiable one
+    bool sat = true;
+    for (int i = 0; i <= _VL_SOLVER_HASH_LEN_TOTAL; i++) {
+        sat = checkSat(f) && sat;
+        if (sat) ++nsat;
+    }
+    // The model is from the last check, so redo the last satisfiable one if it was not last
+    if (nsat && nsat <= _VL_SOLVER_HASH_LEN_TOTAL) {
+        emitCheckSatAssuming(f, nsat - 1);
+        if (!checkSat(f)) nsat = 0;
+    }
+    if (nsat) parseSolution(f);
+    f << "(pop 1)\n";
+    return nsat != 0;
+}
+
+bool VlRandomizer::parseSolution(std::iostream& f) {
     f << "(get-value (";
     for (const auto& var : m_vars) var.second->emitGetValue(f);
     f << "))\n";
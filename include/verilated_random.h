@@ -59,6 +59,7 @@ public:
     virtual void emitType(std::ostream& s) const;
     virtual int totalWidth() const;
     virtual int getLength(int dimension) const { return -1; }
+    virtual bool isScalar() const { return true; }
 };
 
 template <typename T>
@@ -67,6 +68,7 @@ public:
     VlRandomQueueVar(const char* name, int width, void* datap, int dimension,
                      std::uint32_t randModeIdx)
         : VlRandomVar{name, width, datap, dimension, randModeIdx} {}
+    bool isScalar() const override { return false; }
     void* datap(int idx) const override {
         return &static_cast<T*>(VlRandomVar::datap(idx))->atWrite(idx);
     }
@@ -101,6 +103,7 @@ public:
     VlRandomArrayVar(const char* name, int width, void* datap, int dimension,
                      std::uint32_t randModeIdx)
         : VlRandomVar{name, width, datap, dimension, randModeIdx} {}
+    bool isScalar() const override { return false; }
 
     void* datap(int idx) const override {
         if (idx < 0) return &static_cast<T*>(VlRandomVar::datap(0))->operator[](0);
@@ -30,6 +30,7 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <fcntl.h>
 
@@ -49,6 +50,25 @@
 #ifndef O_CLOEXEC  // WIN32 headers omit this
 # define O_CLOEXEC 0
 #endif
+
+// Compile a private copy of LZ4; verilated_fst_c.cpp may link in another, so
+// make the LZ4 API static, and rename the few functions LZ4 leaves external
+#define LZ4LIB_VISIBILITY static
+#define LZ4_DISABLE_DEPRECATE_WARNINGS
+#define LZ4_attach_dictionary vlsave_LZ4_attach_dictionary
+#define LZ4_compress_destSize_extState vlsave_LZ4_compress_destSize_extState
+#define LZ4_compress_fast_extState_fastReset vlsave_LZ4_compress_fast_extState_fastReset
+#define LZ4_compress_forceExtDict vlsave_LZ4_compress_forceExtDict
+#define LZ4_decompress_safe_forceExtDict vlsave_LZ4_decompress_safe_forceExtDict
+#define LZ4_decompress_safe_partial_forceExtDict vlsave_LZ4_decompress_safe_partial_forceExtDict
+#if defined(__GNUC__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#include "gtkwave/lz4.c"
+#if defined(__GNUC__)
+# pragma GCC diagnostic pop
+#endif
 // clang-format on
 
 // CONSTANTS
@@ -56,6 +76,40 @@
 static const char* const VLTSAVE_HEADER_STR = "verilatorsave02\n";
 // Value of last bytes of each file (must be multiple of 8 bytes)
 static const char* const VLTSAVE_TRAILER_STR = "vltsaved";
+// Value of first bytes of each block format file (8 bytes)
+static const char* const VLTSAVE_BLOCK_HEADER_STR = "vltsaveb";
+// Value of last bytes of each block format file, after the block table offset (8 bytes)
+static const char* const VLTSAVE_BLOCK_TRAILER_STR = "vltsavet";
+
+//=============================================================================
+// Block format
+//
+// Files written with VerilatedSave::compress or ::incremental hold the same
+// serialized stream as a plain file, cut into fixed size blocks:
+//    VLTSAVE_BLOCK_HEADER_STR
+//    Stored data of each block written to this file, possibly LZ4 compressed
+//    uint32_t number of files, then for each: uint32_t length, name
+//        (file 0 is this file; others hold blocks of earlier incremental saves)
+//    uint64_t number of blocks, then a VerilatedSaveBlock for each
+//    uint64_t offset of the number of files above
+//    VLTSAVE_BLOCK_TRAILER_STR
+
+// Hash of a block's data, to check restored data, and to skip comparing changed blocks
+static uint64_t vlSaveHash(const uint8_t* datap, size_t size) VL_PURE {
+    uint64_t h1 = 0x9e3779b97f4a7c15ULL ^ size;
+    uint64_t h2 = 0xc2b2ae3d27d4eb4fULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, datap + i, sizeof(word));
+        h1 = (h1 ^ word) * 0xff51afd7ed558ccdULL;
+        h1 ^= h1 >> 32;
+        h2 = (h2 + word) * 0xc4ceb9fe1a85ec53ULL;
+        h2 ^= h2 >> 29;
+    }
+    for (; i < size; ++i) h1 = (h1 ^ datap[i]) * 0x100000001b3ULL;
+    return h1 ^ (h2 * 0x9e3779b97f4a7c15ULL);
+}
 
 //=============================================================================
 //=============================================================================
@@ -127,6 +181,7 @@ void VerilatedDeserialize::trailer() VL_MT_UNSAFE_ONE {
 void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (isOpen()) return;
+    asyncWait();  // The previous save's blocks, and file, must be complete
     VL_DEBUG_IF(VL_DBG_MSGF("- save: opening save file %s\n", filenamep););
 
     if (VL_UNCOVERABLE(filenamep[0] == '|')) {
@@ -144,6 +199,29 @@ void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_isOpen = true;
     m_filename = filenamep;
     m_cp = m_bufp;
+    m_blocked = m_compress || m_incremental;
+    if (m_blocked) {
+        // Blocks of the last save are the base of an incremental save
+        m_prevFiles.swap(m_blockFiles);
+        m_prevBlocks.swap(m_blocks);
+        m_prevData.swap(m_saveData);
+        // Can't refer to a file this open just truncated
+        if (!m_incremental
+            || std::find(m_prevFiles.begin(), m_prevFiles.end(), m_filename)
+                   != m_prevFiles.end()) {
+            m_prevFiles.clear();
+            m_prevBlocks.clear();
+            m_prevData.clear();
+        }
+        // Settings are fixed for the save, as a background write must not see later changes
+        m_blockCompress = m_compress;
+        m_keepData = m_incremental;
+        m_saveData.clear();
+        m_blockFiles.assign(1, m_filename);
+        m_blocks.clear();
+        m_fileOffset = 0;
+        writeFd(VLTSAVE_BLOCK_HEADER_STR, std::strlen(VLTSAVE_BLOCK_HEADER_STR));
+    }
     header();
 }
 
@@ -167,6 +245,14 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_filename = filenamep;
     m_cp = m_bufp;
     m_endp = m_bufp;
+    char magic[8];
+    m_blocked = readFd(m_fd, magic, sizeof(magic))
+                && 0 == std::memcmp(magic, VLTSAVE_BLOCK_HEADER_STR, sizeof(magic));
+    if (m_blocked) {
+        readBlockTable();
+    } else {
+        ::lseek(m_fd, 0, SEEK_SET);
+    }
     header();
 }
 
@@ -174,6 +260,18 @@ void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     if (!isOpen()) return;
     trailer();
     flushImp();
+    if (m_async) {
+        // Snapshot is complete, write it out while the caller continues
+        m_isOpen = false;
+        m_asyncWriting = true;
+        m_asyncThread = std::thread{[this] { asyncWriter(); }};
+        return;
+    }
+    if (m_blocked) {
+        if (m_cp != m_bufp) writeBlock(m_bufp, m_cp - m_bufp);  // Final partial block
+        m_cp = m_bufp;
+        writeBlockTable();
+    }
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
 }
@@ -184,6 +282,9 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     flushImp();
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
+    for (size_t i = 1; i < m_blockFds.size(); ++i) ::close(m_blockFds[i]);
+    m_blockFds.clear();
+    m_blocks.clear();
 }
 
 //=============================================================================
@@ -192,9 +293,33 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
 void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
-    const uint8_t* wp = m_bufp;
+    if (m_async) {
+        // Copy to the snapshot, which is written on close
+        m_asyncData.insert(m_asyncData.end(), m_bufp, m_cp);
+        m_cp = m_bufp;  // Reset buffer
+        return;
+    }
+    if (m_blocked) {
+        // Write whole blocks, keeping any partial block buffered
+        const uint8_t* rp = m_bufp;
+        for (; static_cast<size_t>(m_cp - rp) >= blockSize(); rp += blockSize()) {
+            writeBlock(rp, blockSize());
+        }
+        const size_t remaining = m_cp - rp;
+        std::memmove(m_bufp, rp, remaining);
+        m_cp = m_bufp + remaining;
+        return;
+    }
+    writeFd(m_bufp, m_cp - m_bufp);
+    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedSave::writeFd(const void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    if (VL_UNLIKELY(!m_asyncError.empty())) return;  // Background write already failed
+    const uint8_t* wp = static_cast<const uint8_t*>(datap);
+    const uint8_t* const endp = wp + size;
     while (true) {
-        const ssize_t remaining = (m_cp - wp);
+        const ssize_t remaining = (endp - wp);
         if (remaining == 0) break;
         errno = 0;
         const ssize_t got = ::write(m_fd, wp, remaining);
@@ -205,6 +330,11 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
                 // LCOV_EXCL_START
                 // write failed, presume error (perhaps out of disk space)
                 const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+                if (m_asyncWriting) {
+                    // Not on the saving thread, so asyncWait() reports it
+                    m_asyncError = msg;
+                    break;
+                }
                 VL_FATAL_MT("", 0, "", msg.c_str());
                 close();
                 break;
@@ -212,7 +342,97 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
             }
         }
     }
-    m_cp = m_bufp;  // Reset buffer
+    m_fileOffset += size;
+}
+
+void VerilatedSave::asyncWriter() VL_MT_UNSAFE_ONE {
+    // Runs on m_asyncThread; the saving thread only waits for it to finish
+    const uint8_t* dp = m_asyncData.data();
+    size_t remaining = m_asyncData.size();
+    if (m_blocked) {
+        while (remaining) {
+            const size_t size = std::min(remaining, blockSize());
+            writeBlock(dp, size);
+            dp += size;
+            remaining -= size;
+        }
+        writeBlockTable();
+    } else {
+        writeFd(dp, remaining);
+    }
+    ::close(m_fd);  // May get error, just ignore it
+    m_asyncData.clear();  // Keep the allocation for the next snapshot
+}
+
+void VerilatedSave::asyncWait() VL_MT_UNSAFE_ONE {
+    if (!m_asyncThread.joinable()) return;
+    m_asyncThread.join();
+    m_asyncWriting = false;
+    if (VL_UNLIKELY(!m_asyncError.empty())) {
+        // LCOV_EXCL_START
+        const std::string msg = m_asyncError;
+        m_asyncError.clear();
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        // LCOV_EXCL_STOP
+    }
+}
+
+uint32_t VerilatedSave::blockFileIndex(const std::string& filename) VL_MT_UNSAFE_ONE {
+    const auto it = std::find(m_blockFiles.begin(), m_blockFiles.end(), filename);
+    if (it != m_blockFiles.end()) return static_cast<uint32_t>(it - m_blockFiles.begin());
+    m_blockFiles.push_back(filename);
+    return static_cast<uint32_t>(m_blockFiles.size() - 1);
+}
+
+void VerilatedSave::writeBlock(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    VerilatedSaveBlock block;
+    block.m_hash = vlSaveHash(datap, size);
+    block.m_raw = static_cast<uint32_t>(size);
+    const size_t index = m_blocks.size();
+    const size_t dataOffset = index * blockSize();  // All blocks but the last are full
+    // Hashes may collide, so compare the data of blocks whose hashes match
+    if (index < m_prevBlocks.size() && m_prevBlocks[index].m_hash == block.m_hash
+        && m_prevBlocks[index].m_raw == block.m_raw && dataOffset + size <= m_prevData.size()
+        && 0 == std::memcmp(m_prevData.data() + dataOffset, datap, size)) {
+        // Unchanged since the previous save, refer to the copy already written
+        block = m_prevBlocks[index];
+        block.m_file = blockFileIndex(m_prevFiles[block.m_file]);
+    } else {
+        const char* storep = reinterpret_cast<const char*>(datap);
+        block.m_file = 0;
+        block.m_offset = m_fileOffset;
+        block.m_stored = block.m_raw;
+        block.m_compressed = 0;
+        if (m_blockCompress) {
+            m_packBuf.resize(LZ4_compressBound(blockSize()));
+            const int packed = LZ4_compress_default(storep, m_packBuf.data(), block.m_raw,
+                                                    static_cast<int>(m_packBuf.size()));
+            if (packed > 0 && static_cast<uint32_t>(packed) < block.m_raw) {
+                storep = m_packBuf.data();
+                block.m_stored = packed;
+                block.m_compressed = 1;
+            }
+        }
+        writeFd(storep, block.m_stored);
+    }
+    m_blocks.push_back(block);
+    if (m_keepData) m_saveData.insert(m_saveData.end(), datap, datap + size);
+}
+
+void VerilatedSave::writeBlockTable() VL_MT_UNSAFE_ONE {
+    const uint64_t tableOffset = m_fileOffset;
+    const uint32_t nFiles = m_blockFiles.size();
+    writeFd(&nFiles, sizeof(nFiles));
+    for (const std::string& name : m_blockFiles) {
+        const uint32_t len = name.size();
+        writeFd(&len, sizeof(len));
+        writeFd(name.data(), len);
+    }
+    const uint64_t nBlocks = m_blocks.size();
+    writeFd(&nBlocks, sizeof(nBlocks));
+    writeFd(m_blocks.data(), nBlocks * sizeof(VerilatedSaveBlock));
+    writeFd(&tableOffset, sizeof(tableOffset));
+    writeFd(VLTSAVE_BLOCK_TRAILER_STR, std::strlen(VLTSAVE_BLOCK_TRAILER_STR));
 }
 
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
@@ -223,6 +443,19 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     for (uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
     m_endp = m_bufp + (m_endp - m_cp);
     m_cp = m_bufp;  // Reset buffer
+    if (m_blocked) {
+        // Read whole blocks while they fit
+        while (m_nextBlock < m_blocks.size()) {
+            const VerilatedSaveBlock& block = m_blocks[m_nextBlock];
+            if (block.m_raw > static_cast<size_t>(m_bufp + bufferSize() - m_endp)) return;
+            readBlock(block, m_endp);
+            m_endp += block.m_raw;
+            ++m_nextBlock;
+        }
+        // End of data, fill with NULLs as at EOF below
+        while (m_endp < m_bufp + bufferSize()) *m_endp++ = '\0';
+        return;
+    }
     // Read into buffer starting at m_endp
     while (true) {
         const ssize_t remaining = (m_bufp + bufferSize() - m_endp);
@@ -250,6 +483,104 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+bool VerilatedRestore::readFd(int fd, void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    uint8_t* rp = static_cast<uint8_t*>(datap);
+    uint8_t* const endp = rp + size;
+    while (rp < endp) {
+        errno = 0;
+        const ssize_t got = ::read(fd, rp, endp - rp);
+        if (got > 0) {
+            rp += got;
+        } else if (got == 0 || (errno != EAGAIN && errno != EINTR)) {
+            return false;  // EOF or error
+        }
+    }
+    return true;
+}
+
+void VerilatedRestore::fatalCorrupt(const std::string& what) VL_MT_UNSAFE_ONE {
+    const std::string fn = filename();
+    const std::string msg = "Can't deserialize; " + what + " in save file: " + filename();
+    VL_FATAL_MT(fn.c_str(), 0, "", msg.c_str());
+}
+
+void VerilatedRestore::readBlockTable() VL_MT_UNSAFE_ONE {
+    uint64_t tableOffset = 0;
+    char trailer[8];
+    const off_t fileSize = ::lseek(m_fd, -16, SEEK_END) + 16;
+    if (fileSize < 16 || !readFd(m_fd, &tableOffset, sizeof(tableOffset))
+        || !readFd(m_fd, trailer, sizeof(trailer))
+        || 0 != std::memcmp(trailer, VLTSAVE_BLOCK_TRAILER_STR, sizeof(trailer))
+        || tableOffset > static_cast<uint64_t>(fileSize)
+        || ::lseek(m_fd, tableOffset, SEEK_SET) < 0) {
+        fatalCorrupt("wrong end-of-file signature");
+        return;
+    }
+    uint32_t nFiles = 0;
+    if (!readFd(m_fd, &nFiles, sizeof(nFiles)) || nFiles < 1) {
+        fatalCorrupt("corrupt block table");
+        return;
+    }
+    m_blockFds.assign(1, m_fd);
+    for (uint32_t i = 0; i < nFiles; ++i) {
+        uint32_t len = 0;
+        std::string name;
+        if (readFd(m_fd, &len, sizeof(len)) && len <= fileSize) {
+            name.resize(len);
+            if (!readFd(m_fd, &name[0], len)) len = ~0U;
+        }
+        if (len != name.size()) {
+            fatalCorrupt("corrupt block table");
+            return;
+        }
+        if (i == 0) continue;  // This file, which may have been renamed
+        const int fd = ::open(name.c_str(), O_RDONLY | O_LARGEFILE | O_CLOEXEC);
+        if (VL_UNLIKELY(fd < 0)) {
+            fatalCorrupt("can't open referenced earlier save file '" + name + "'");
+            return;
+        }
+        m_blockFds.push_back(fd);
+    }
+    uint64_t nBlocks = 0;
+    if (!readFd(m_fd, &nBlocks, sizeof(nBlocks))
+        || nBlocks > static_cast<uint64_t>(fileSize) / sizeof(VerilatedSaveBlock)) {
+        fatalCorrupt("corrupt block table");
+        return;
+    }
+    m_blocks.resize(nBlocks);
+    if (!readFd(m_fd, m_blocks.data(), nBlocks * sizeof(VerilatedSaveBlock))) {
+        fatalCorrupt("corrupt block table");
+        return;
+    }
+    for (const VerilatedSaveBlock& block : m_blocks) {
+        // Each block must fit in the buffer after fill() has kept a partial insert
+        if (block.m_file >= m_blockFds.size()
+            || block.m_raw > bufferSize() - bufferInsertSize()) {
+            fatalCorrupt("corrupt block table");
+            return;
+        }
+    }
+    m_nextBlock = 0;
+}
+
+void VerilatedRestore::readBlock(const VerilatedSaveBlock& block,
+                                 uint8_t* destp) VL_MT_UNSAFE_ONE {
+    const int fd = m_blockFds[block.m_file];
+    bool ok = ::lseek(fd, block.m_offset, SEEK_SET) >= 0;
+    if (ok && block.m_compressed) {
+        m_packBuf.resize(block.m_stored);
+        ok = readFd(fd, m_packBuf.data(), block.m_stored)
+             && LZ4_decompress_safe(m_packBuf.data(), reinterpret_cast<char*>(destp),
+                                    block.m_stored, block.m_raw)
+                    == static_cast<int>(block.m_raw);
+    } else if (ok) {
+        ok = block.m_stored == block.m_raw && readFd(fd, destp, block.m_raw);
+    }
+    if (VL_UNLIKELY(!ok || vlSaveHash(destp, block.m_raw) != block.m_hash)) {
+        fatalCorrupt("corrupt data block");
+    }
+}
+
 //=============================================================================
 // Serialization of types
 
@@ -27,6 +27,21 @@
 #include "verilated.h"
 
 #include <string>
+#include <thread>
+#include <vector>
+
+//=============================================================================
+// VerilatedSaveBlock
+/// Internal: Location of one block of a block-format save file.
+
+struct VerilatedSaveBlock final {
+    uint64_t m_hash;  // Hash of the uncompressed data
+    uint64_t m_offset;  // Offset of the stored data in its file
+    uint32_t m_file;  // Index of the file holding the stored data
+    uint32_t m_stored;  // Stored size in bytes
+    uint32_t m_raw;  // Uncompressed size in bytes
+    uint32_t m_compressed;  // Nonzero if stored data is LZ4 compressed
+};
 
 //=============================================================================
 // VerilatedSerialize
@@ -189,17 +204,61 @@ private:
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    bool m_compress = false;  // Compress blocks with LZ4
+    bool m_incremental = false;  // Only write blocks changed since previous save
+    bool m_blocked = false;  // Writing block format (compress or incremental)
+    bool m_blockCompress = false;  // Compressing blocks, m_compress when opened
+    uint64_t m_fileOffset = 0;  // Bytes written to the current file
+    std::vector<std::string> m_blockFiles;  // Files holding m_blocks, [0] is current file
+    std::vector<VerilatedSaveBlock> m_blocks;  // Blocks of the current save
+    std::vector<std::string> m_prevFiles;  // Files holding m_prevBlocks
+    std::vector<VerilatedSaveBlock> m_prevBlocks;  // Blocks of the previous save
+    bool m_keepData = false;  // Keep m_saveData, as the current save is incremental
+    std::vector<uint8_t> m_saveData;  // Data of the current save, if m_keepData
+    std::vector<uint8_t> m_prevData;  // Data of the previous save, to find unchanged blocks
+    std::vector<char> m_packBuf;  // Compression output buffer
+    bool m_async = false;  // Write files from a background thread
+    std::vector<uint8_t> m_asyncData;  // Snapshot of the data being saved
+    std::thread m_asyncThread;  // Thread writing the last save, if any
+    bool m_asyncWriting = false;  // Set while m_asyncThread is writing, so errors are deferred
+    std::string m_asyncError;  // First error of the background write, reported by asyncWait()
+
+    static constexpr size_t blockSize() { return 64 * 1024; }
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
+    void writeFd(const void* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void writeBlock(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void writeBlockTable() VL_MT_UNSAFE_ONE;
+    uint32_t blockFileIndex(const std::string& filename) VL_MT_UNSAFE_ONE;
+    void asyncWriter() VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
     /// Construct new object
     VerilatedSave() = default;
     /// Flush, close and destruct
-    ~VerilatedSave() override { closeImp(); }
+    ~VerilatedSave() override {
+        closeImp();
+        asyncWait();
+    }
     // METHODS
+    /// Compress the saved data with LZ4.  Call before open().
+    void compress(bool flag) VL_MT_UNSAFE_ONE { m_compress = flag; }
+    /// Save only the blocks of data that changed since the previous save made
+    /// with this object, referring to the earlier files for the rest.  Those
+    /// files must be kept, under the same names, to restore.  A copy of the
+    /// previous save's data is kept in memory to find the unchanged blocks.
+    /// Call before open().
+    void incremental(bool flag) VL_MT_UNSAFE_ONE { m_incremental = flag; }
+    /// Save to an in-memory snapshot, and have close() return while a
+    /// background thread compresses and writes the file.  The next open(),
+    /// asyncWait(), or destruction waits for that write, and reports any
+    /// error writing the file.  Call before open().
+    void async(bool flag) VL_MT_UNSAFE_ONE { m_async = flag; }
+    /// Wait for the background write of the last save to complete, and
+    /// report any error writing it
+    void asyncWait() VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
@@ -219,9 +278,18 @@ public:
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    bool m_blocked = false;  // Reading block format
+    std::vector<int> m_blockFds;  // File descriptors of files holding blocks, [0] is m_fd
+    std::vector<VerilatedSaveBlock> m_blocks;  // Blocks to read
+    size_t m_nextBlock = 0;  // Index of next block to read
+    std::vector<char> m_packBuf;  // Compressed input buffer
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
+    bool readFd(int fd, void* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void readBlockTable() VL_MT_UNSAFE_ONE;
+    void readBlock(const VerilatedSaveBlock& block, uint8_t* destp) VL_MT_UNSAFE_ONE;
+    void fatalCorrupt(const std::string& what) VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -328,4 +396,33 @@ VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VlAssocArray<T_Key, T
     return os;
 }
 
+template <class T_Key, class T_Value>
+VerilatedSerialize& operator<<(VerilatedSerialize& os, VlHashAssocArray<T_Key, T_Value>& rhs) {
+    os << rhs.atDefault();
+    const uint32_t len = rhs.size();
+    os << len;
+    for (const auto& i : rhs) {
+        const T_Key index = i.first;  // Copy to get around const_iterator
+        const T_Value value = i.second;
+        os << index << value;
+    }
+    return os;
+}
+template <class T_Key, class T_Value>
+VerilatedDeserialize& operator>>(VerilatedDeserialize& os,
+                                 VlHashAssocArray<T_Key, T_Value>& rhs) {
+    os >> rhs.atDefault();
+    uint32_t len = 0;
+    os >> len;
+    rhs.clear();
+    for (uint32_t i = 0; i < len; ++i) {
+        T_Key index;
+        T_Value value;
+        os >> index;
+        os >> value;
+        rhs.at(index) = value;
+    }
+    return os;
+}
+
 #endif  // Guard
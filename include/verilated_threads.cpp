@@ -48,9 +48,11 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
-    : m_ready_size{0}
-    , m_cthread{startWorker, this, contextp} {}
+VlWorkerThread::VlWorkerThread(VerilatedContext* contextp, uint32_t poolIndex) {
+    for (size_t i = 0; i < QUEUE_SIZE; ++i) m_slots[i].m_seq.store(i, std::memory_order_relaxed);
+    // Start the thread last, once the ring is initialized
+    m_cthread = std::thread{startWorker, this, contextp, poolIndex};
+}
 
 VlWorkerThread::~VlWorkerThread() {
     shutdown();
@@ -91,8 +93,10 @@ void VlWorkerThread::workerLoop() {
     }
 }
 
-void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp) {
+void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp,
+                                 uint32_t poolIndex) {
     Verilated::threadContextp(contextp);
+    Verilated::poolIndex(poolIndex);
     workerp->workerLoop();
 }
 
@@ -100,7 +104,10 @@ void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* cont
 // VlThreadPool
 
 VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
-    for (unsigned i = 0; i < nThreads; ++i) m_workers.push_back(new VlWorkerThread{contextp});
+    // Worker i runs the model's thread i + 1, the main thread being 0
+    for (unsigned i = 0; i < nThreads; ++i) {
+        m_workers.push_back(new VlWorkerThread{contextp, i + 1});
+    }
 }
 
 VlThreadPool::~VlThreadPool() {
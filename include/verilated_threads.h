@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <set>
 #include <thread>
 #include <vector>
@@ -138,26 +139,69 @@ private:
             , m_evenCycle{evenCycle} {}
     };
 
+    // Lock-free bounded multi-producer, single-consumer ring of pending
+    // work. Each slot carries a sequence number (after D. Vyukov's bounded
+    // queue) so producers claim a slot with a single CAS on m_tail, and the
+    // owning worker dequeues with plain loads/stores, no mutex involved.
+    // Hand-off on the hot path is hence a few atomic operations; the mutex
+    // and condition variable are only touched to park/unpark an idle worker.
+    static constexpr size_t QUEUE_SIZE = 1024;  // Must be a power of 2
+    static constexpr size_t QUEUE_MASK = QUEUE_SIZE - 1;
+    static_assert((QUEUE_SIZE & QUEUE_MASK) == 0, "QUEUE_SIZE must be a power of 2");
+    struct Slot final {
+        std::atomic<size_t> m_seq;  // Slot sequence number
+        ExecRec m_rec;  // Work item
+    };
+
     // MEMBERS
-    mutable VerilatedMutex m_mutex;
-    std::condition_variable_any m_cv;
-    // Only notify the condition_variable if the worker is waiting
-    bool m_waiting VL_GUARDED_BY(m_mutex) = false;
-
-    // Why a vector? We expect the pending list to be very short, typically
-    // 0 or 1 or 2, so popping from the front shouldn't be
-    // expensive. Revisit if we ever have longer queues...
-    std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
-    // Store the size atomically, so we can spin wait
-    std::atomic<size_t> m_ready_size;
+    // Producer and consumer state are padded apart to avoid false sharing.
+    // (Padding rather than alignas, as C++14 'new' ignores over-alignment.)
+    Slot m_slots[QUEUE_SIZE];  // Ring storage
+    size_t m_head = 0;  // Next slot to dequeue, only accessed by the worker
+    uint8_t m_pad0[VL_CACHE_LINE_BYTES];  // Padding
+    std::atomic<size_t> m_tail{0};  // Next slot to enqueue
+    uint8_t m_pad1[VL_CACHE_LINE_BYTES];  // Padding
+    std::atomic<bool> m_waiting{false};  // Worker is (about to be) parked
+    mutable VerilatedMutex m_mutex;  // Only used for parking the worker
+    std::condition_variable_any m_cv;  // Only used for parking the worker
 
     std::thread m_cthread;  // Underlying C++ thread record
 
     VL_UNCOPYABLE(VlWorkerThread);
 
+    // Try to take the next work item. Only called from the worker thread.
+    bool tryDeque(ExecRec* workp) {
+        Slot& slot = m_slots[m_head & QUEUE_MASK];
+        if (slot.m_seq.load(std::memory_order_acquire) != m_head + 1) return false;
+        *workp = slot.m_rec;
+        slot.m_seq.store(m_head + QUEUE_SIZE, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+    // Try to add a work item, fails if the ring is full. Any thread.
+    bool tryEnqueue(VlExecFnp fnp, VlSelfP selfp, bool evenCycle) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = m_slots[pos & QUEUE_MASK];
+            const size_t seq = slot.m_seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.m_rec = ExecRec{fnp, selfp, evenCycle};
+                    slot.m_seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VerilatedContext* contextp, uint32_t poolIndex);
     ~VlWorkerThread();
 
     // METHODS
@@ -166,39 +210,201 @@ public:
         // Spin for a while, waiting for new data
         if VL_CONSTEXPR_CXX17 (SpinWait) {
             for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
+                if (VL_LIKELY(tryDeque(workp))) return;
                 VL_CPU_RELAX();
             }
         }
+        if (tryDeque(workp)) return;
+        // Nothing arrived, park until a producer wakes us. m_waiting is
+        // published before re-checking the ring, and producers check
+        // m_waiting after publishing their item (both sequentially
+        // consistent), so a wakeup cannot be lost.
         VerilatedLockGuard lock{m_mutex};
-        while (m_ready.empty()) {
-            m_waiting = true;
+        while (true) {
+            m_waiting.store(true, std::memory_order_seq_cst);
+            if (tryDeque(workp)) break;
             m_cv.wait(m_mutex);
         }
-        m_waiting = false;
-        // As noted above this is inefficient if our ready list is ever
-        // long (but it shouldn't be)
-        *workp = m_ready.front();
-        m_ready.erase(m_ready.begin());
-        m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+        m_waiting.store(false, std::memory_order_relaxed);
     }
     void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
         VL_MT_SAFE_EXCLUDES(m_mutex) {
-        bool notify;
-        {
-            const VerilatedLockGuard lock{m_mutex};
-            m_ready.emplace_back(fnp, selfp, evenCycle);
-            m_ready_size.fetch_add(1, std::memory_order_relaxed);
-            notify = m_waiting;
+        // The ring only fills if the worker is far behind; just back off
+        while (VL_UNLIKELY(!tryEnqueue(fnp, selfp, evenCycle))) std::this_thread::yield();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (VL_UNLIKELY(m_waiting.load(std::memory_order_seq_cst))) {
+            // Take the lock so the notification can't slip in between the
+            // worker's re-check and its wait
+            { const VerilatedLockGuard lock{m_mutex}; }
+            m_cv.notify_one();
         }
-        if (notify) m_cv.notify_one();
     }
 
     void shutdown();  // Finish current tasks, then terminate thread
     void wait();  // Blocks calling thread until all tasks complete in this thread
 
     void workerLoop();
-    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp);
+    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp,
+                            uint32_t poolIndex);
+};
+
+// Shared queue of ready mtasks, used by --threads-schedule dynamic.
+// Each mtask function pushes its successors when they become ready, and
+// all participating threads pop and execute mtasks until the graph is done.
+// Mtasks are pushed into one of BANDS priority bands, chosen at Verilation
+// time from their critical path, and are popped from the highest priority
+// non-empty band, first in first out within a band.
+class VlMTaskReadyQueue final {
+public:
+    static constexpr unsigned BANDS = 4;  // Priority bands, 0 is the highest priority
+
+private:
+    // TYPES
+    struct Slot final {
+        std::atomic<size_t> m_seq;  // Slot sequence number
+        VlExecFnp m_fnp;  // Ready mtask
+    };
+    // Bounded multi-producer, multi-consumer ring of one band. Capacity is at
+    // least the number of mtasks in the graph, as each mtask is pushed once per run.
+    struct Ring final {
+        std::unique_ptr<Slot[]> m_slotsp;  // Ring storage
+        size_t m_mask = 0;  // Capacity - 1
+        uint8_t m_pad0[VL_CACHE_LINE_BYTES];  // Padding
+        std::atomic<size_t> m_head{0};  // Next slot to pop
+        uint8_t m_pad1[VL_CACHE_LINE_BYTES];  // Padding
+        std::atomic<size_t> m_tail{0};  // Next slot to push
+        uint8_t m_pad2[VL_CACHE_LINE_BYTES];  // Padding
+
+        void reserve(uint32_t nMTasks) {
+            if (VL_LIKELY(nMTasks <= m_mask)) return;
+            // First run, (re)allocate. The ring is always empty between runs.
+            size_t capacity = 1;
+            while (capacity < nMTasks + 1) capacity <<= 1;
+            m_slotsp.reset(new Slot[capacity]);
+            for (size_t i = 0; i < capacity; ++i) {
+                m_slotsp[i].m_seq.store(i, std::memory_order_relaxed);
+            }
+            m_mask = capacity - 1;
+            m_head.store(0, std::memory_order_relaxed);
+            m_tail.store(0, std::memory_order_relaxed);
+        }
+        bool tryPop(VlExecFnp& fnp) {
+            size_t pos = m_head.load(std::memory_order_relaxed);
+            while (true) {
+                Slot& slot = m_slotsp[pos & m_mask];
+                const size_t seq = slot.m_seq.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0) {
+                    if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        fnp = slot.m_fnp;
+                        slot.m_seq.store(pos + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;  // Empty
+                } else {
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        void push(VlExecFnp fnp) {
+            size_t pos = m_tail.load(std::memory_order_relaxed);
+            while (true) {
+                Slot& slot = m_slotsp[pos & m_mask];
+                const size_t seq = slot.m_seq.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        slot.m_fnp = fnp;
+                        slot.m_seq.store(pos + 1, std::memory_order_release);
+                        return;
+                    }
+                } else {
+                    assert(diff > 0);  // Never full, as sized for the whole graph
+                    pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    // MEMBERS
+    Ring m_bands[BANDS];  // Ready mtasks of each priority band
+    VlSelfP m_selfp = nullptr;  // Symbol table to execute mtasks with
+    bool m_evenCycle = false;  // Even/odd for flag alternation
+    uint8_t m_pad0[VL_CACHE_LINE_BYTES];  // Padding
+    std::atomic<uint32_t> m_pending{0};  // Number of mtasks not yet completed
+    std::atomic<uint32_t> m_helpers{0};  // Number of worker threads still executing
+
+    VL_UNCOPYABLE(VlMTaskReadyQueue);
+
+    bool tryPop(VlExecFnp& fnp) {
+        for (Ring& ring : m_bands) {
+            if (ring.tryPop(fnp)) return true;
+        }
+        return false;
+    }
+    // Execute ready mtasks until every mtask in the graph has completed
+    void drain() {
+        unsigned ct = 0;
+        while (m_pending.load(std::memory_order_acquire)) {
+            VlExecFnp fnp;
+            if (tryPop(fnp)) {
+                fnp(m_selfp, m_evenCycle);
+                ct = 0;
+                continue;
+            }
+            VL_CPU_RELAX();
+            if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+                ct = 0;
+                VlMTaskVertex::yieldThread();
+            }
+        }
+    }
+
+public:
+    // CONSTRUCTORS
+    VlMTaskReadyQueue() = default;
+    ~VlMTaskReadyQueue() = default;
+
+    // METHODS
+    // Prepare for executing a graph of 'nMTasks' with 'nHelpers' worker
+    // threads. Called by the main thread, before pushing the root mtasks.
+    void start(VlSelfP selfp, bool evenCycle, uint32_t nMTasks, uint32_t nHelpers) {
+        for (Ring& ring : m_bands) ring.reserve(nMTasks);
+        m_selfp = selfp;
+        m_evenCycle = evenCycle;
+        m_pending.store(nMTasks, std::memory_order_relaxed);
+        m_helpers.store(nHelpers, std::memory_order_relaxed);
+    }
+    // Add a ready mtask in the given priority band. Called by the mtask that
+    // satisfied its last dependency.
+    void push(VlExecFnp fnp, unsigned band) {
+        // Pairs with the release in VlMTaskVertex::signalUpstreamDone, so the
+        // effects of all upstream mtasks are visible to whoever pops this one
+        std::atomic_thread_fence(std::memory_order_acquire);
+        m_bands[band].push(fnp);
+    }
+    // Mark one mtask as completed. Called at the end of each mtask.
+    void done() { m_pending.fetch_sub(1, std::memory_order_release); }
+    // Execute mtasks on the main thread, and return when the graph is
+    // done and all helper threads have stopped using the queue
+    void execute() {
+        drain();
+        unsigned ct = 0;
+        while (m_helpers.load(std::memory_order_acquire)) {
+            VL_CPU_RELAX();
+            if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+                ct = 0;
+                VlMTaskVertex::yieldThread();
+            }
+        }
+    }
+    // Task for VlWorkerThread::addTask, to execute mtasks on a worker thread
+    static void helperTask(VlSelfP queuep, bool) {
+        VlMTaskReadyQueue* const selfp = static_cast<VlMTaskReadyQueue*>(queuep);
+        selfp->drain();
+        selfp->m_helpers.fetch_sub(1, std::memory_order_release);
+    }
 };
 
 class VlThreadPool final : public VerilatedVirtualBase {
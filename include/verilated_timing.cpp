@@ -22,6 +22,9 @@
 
 #include "verilated_timing.h"
 
+#include <algorithm>
+#include <set>
+
 //======================================================================
 // VlCoroutineHandle:: Methods
 
@@ -50,6 +53,117 @@ void VlCoroutineHandle::dump() const {
 }
 #endif
 
+//======================================================================
+// VlDelayQueue:: Methods
+
+static int vlFirstSetBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    for (; !(word & 1); word >>= 1) ++bit;
+    return bit;
+#endif
+}
+
+uint32_t VlDelayQueue::unlink(int level, int slot) {
+    Slot& slotr = m_slots[level][slot];
+    const uint32_t head = slotr.m_head;
+    slotr.m_head = slotr.m_tail = NONE;
+    m_occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+    return head;
+}
+
+void VlDelayQueue::rebase(uint64_t time) {
+    // A time before the last popped time is being pushed, so re-place every entry relative to it
+    std::vector<uint32_t> entries;
+    for (int level = 0; level < LEVELS; ++level) {
+        for (int slot = 0; slot < SLOTS; ++slot) {
+            for (uint32_t index = unlink(level, slot); index != NONE;
+                 index = m_pool[index].m_next) {
+                entries.push_back(index);
+            }
+        }
+    }
+    m_now = time;
+    for (const uint32_t index : entries) link(index);
+}
+
+uint64_t VlDelayQueue::findNext() const {
+    if (!m_size) return ~0ULL;
+    // Entries at a lower level are all earlier than those at higher levels, and within a level
+    // lower slots are earlier. Every entry in a level 0 slot has the same time.
+    for (int level = 0; level < LEVELS; ++level) {
+        for (int word = 0; word < WORDS; ++word) {
+            if (!m_occupied[level][word]) continue;
+            const int slot = word * 64 + vlFirstSetBit(m_occupied[level][word]);
+            uint32_t index = m_slots[level][slot].m_head;
+            uint64_t next = m_pool[index].m_time;
+            for (index = m_pool[index].m_next; index != NONE; index = m_pool[index].m_next) {
+                next = std::min(next, m_pool[index].m_time);
+            }
+            return next;
+        }
+    }
+    return ~0ULL;  // LCOV_EXCL_LINE
+}
+
+void VlDelayQueue::pop(std::vector<VlCoroutineHandle>& handles) {
+    const uint64_t time = m_next;
+    // Move the entries sharing a slot with 'time' down to be relative to 'time', which brings
+    // all entries at 'time' to level 0
+    const int level = levelOf(time);
+    uint32_t index = level ? unlink(level, slotOf(time, level)) : NONE;
+    m_now = time;
+    while (index != NONE) {
+        const uint32_t next = m_pool[index].m_next;
+        link(index);
+        index = next;
+    }
+    // Take the entries at 'time'
+    m_popped.clear();
+    for (index = unlink(0, slotOf(time, 0)); index != NONE; index = m_pool[index].m_next) {
+        m_popped.push_back(index);
+    }
+    // Moving entries down can put later pushed entries first
+    const auto seqLess
+        = [this](uint32_t a, uint32_t b) { return m_pool[a].m_seq < m_pool[b].m_seq; };
+    if (!std::is_sorted(m_popped.begin(), m_popped.end(), seqLess)) {
+        std::sort(m_popped.begin(), m_popped.end(), seqLess);
+    }
+    for (const uint32_t popped : m_popped) {
+        Entry& entry = m_pool[popped];
+        handles.emplace_back(std::move(entry.m_handle));
+        entry.m_next = m_free;
+        m_free = popped;
+    }
+    m_size -= m_popped.size();
+    m_next = findNext();
+}
+
+#ifdef VL_DEBUG
+void VlDelayQueue::dump() const {
+    std::vector<uint32_t> entries;
+    for (int level = 0; level < LEVELS; ++level) {
+        for (int slot = 0; slot < SLOTS; ++slot) {
+            for (uint32_t index = m_slots[level][slot].m_head; index != NONE;
+                 index = m_pool[index].m_next) {
+                entries.push_back(index);
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [this](uint32_t a, uint32_t b) {
+        const Entry& ae = m_pool[a];
+        const Entry& be = m_pool[b];
+        return ae.m_time < be.m_time || (ae.m_time == be.m_time && ae.m_seq < be.m_seq);
+    });
+    for (const uint32_t index : entries) {
+        VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", m_pool[index].m_time);
+        m_pool[index].m_handle.dump();
+    }
+}
+#endif
+
 //======================================================================
 // VlDelayScheduler:: Methods
 
@@ -59,10 +173,11 @@ void VlDelayScheduler::resume() {
 #endif
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
+    while (!m_queue.empty() && (m_queue.nextTime() == m_context.time())) {
+        // Resumed coroutines can only delay to later times, so will not be popped here
+        m_queue.pop(m_resumed);
+        for (auto&& handle : m_resumed) handle.resume();
+        m_resumed.clear();
         resumed = true;
     }
 
@@ -87,7 +202,7 @@ void VlDelayScheduler::resume() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (!m_queue.empty()) return m_queue.nextTime();
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "%Error: There is no next time slot scheduled");
     return m_context.time();
@@ -105,10 +220,7 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
-        }
+        m_queue.dump();
     }
 }
 #endif
@@ -224,6 +336,170 @@ void VlForkSync::done(const char* filename, int lineno) {
     if (m_join->m_counter == 0) m_join->m_susp.resume();
 }
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+// Statistics of one thread. Only the owning thread writes these, so counting needs no atomic
+// read-modify-write; they are atomic only so stats() may read them from other threads.
+struct VlFrameThreadStats final {
+    std::atomic<uint64_t> m_allocs{0};
+    std::atomic<uint64_t> m_reuses{0};
+    std::atomic<uint64_t> m_frees{0};
+    std::atomic<uint64_t> m_bytes{0};
+    std::atomic<uint64_t> m_maxSize{0};
+    std::atomic<uint64_t> m_unpooled{0};
+};
+
+// Add to a counter written only by the calling thread
+static void vlFrameCount(std::atomic<uint64_t>& counter, uint64_t n) {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+static void vlFrameStatsAdd(VlCoroutineFramePool::Stats& sum,
+                            const VlCoroutineFramePool::Stats& stats) {
+    sum.m_allocs += stats.m_allocs;
+    sum.m_reuses += stats.m_reuses;
+    sum.m_frees += stats.m_frees;
+    sum.m_bytes += stats.m_bytes;
+    sum.m_maxSize = std::max(sum.m_maxSize, stats.m_maxSize);
+    sum.m_unpooled += stats.m_unpooled;
+}
+
+static VlCoroutineFramePool::Stats vlFrameStatsLoad(const VlFrameThreadStats& threadStats) {
+    VlCoroutineFramePool::Stats stats;
+    stats.m_allocs = threadStats.m_allocs.load(std::memory_order_relaxed);
+    stats.m_reuses = threadStats.m_reuses.load(std::memory_order_relaxed);
+    stats.m_frees = threadStats.m_frees.load(std::memory_order_relaxed);
+    stats.m_bytes = threadStats.m_bytes.load(std::memory_order_relaxed);
+    stats.m_maxSize = threadStats.m_maxSize.load(std::memory_order_relaxed);
+    stats.m_unpooled = threadStats.m_unpooled.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// Statistics of running threads, and the sum of those of exited threads
+struct VlFrameStatsRegistry final {
+    VerilatedMutex m_mutex;
+    std::set<const VlFrameThreadStats*> m_threads VL_GUARDED_BY(m_mutex);
+    VlCoroutineFramePool::Stats m_exited VL_GUARDED_BY(m_mutex);
+};
+static VlFrameStatsRegistry& vlFrameStatsRegistry() {
+    static VlFrameStatsRegistry s_registry;
+    return s_registry;
+}
+
+// Count in the exited threads' sum, for frames handled after the thread's statistics are gone
+static void vlFrameStatsExited(const VlCoroutineFramePool::Stats& stats) {
+    VlFrameStatsRegistry& registry = vlFrameStatsRegistry();
+    const VerilatedLockGuard lock{registry.m_mutex};
+    vlFrameStatsAdd(registry.m_exited, stats);
+}
+
+// Free frames and statistics of one thread. Each free frame's first word links to the next.
+struct VlFrameFreeLists final {
+    void* m_heads[VlCoroutineFramePool::CLASSES] = {};
+    VlFrameThreadStats m_stats;
+    VlFrameFreeLists();
+    ~VlFrameFreeLists();
+};
+static thread_local VlFrameFreeLists t_frameFreeLists;
+// Set once t_frameFreeLists is destroyed, as frames may be freed during later destruction
+static thread_local bool t_frameFreeListsGone = false;
+
+VlFrameFreeLists::VlFrameFreeLists() {
+    VlFrameStatsRegistry& registry = vlFrameStatsRegistry();
+    const VerilatedLockGuard lock{registry.m_mutex};
+    registry.m_threads.insert(&m_stats);
+}
+
+VlFrameFreeLists::~VlFrameFreeLists() {
+    {
+        VlFrameStatsRegistry& registry = vlFrameStatsRegistry();
+        const VerilatedLockGuard lock{registry.m_mutex};
+        vlFrameStatsAdd(registry.m_exited, vlFrameStatsLoad(m_stats));
+        registry.m_threads.erase(&m_stats);
+    }
+    for (void*& head : m_heads) {
+        while (head) {
+            void* const nextp = *static_cast<void**>(head);
+            ::operator delete(head);
+            head = nextp;
+        }
+    }
+    t_frameFreeListsGone = true;
+}
+
+void* VlCoroutineFramePool::allocate(size_t size) {
+    const size_t sizeClass = (size + GRANULE - 1) / GRANULE;
+    if (VL_UNLIKELY(t_frameFreeListsGone)) {
+        Stats stats;
+        stats.m_allocs = 1;
+        stats.m_bytes = size;
+        stats.m_maxSize = size;
+        stats.m_unpooled = sizeClass >= CLASSES;
+        vlFrameStatsExited(stats);
+        return ::operator new(sizeClass >= CLASSES ? size : sizeClass * GRANULE);
+    }
+    VlFrameFreeLists& lists = t_frameFreeLists;
+    VlFrameThreadStats& stats = lists.m_stats;
+    vlFrameCount(stats.m_allocs, 1);
+    vlFrameCount(stats.m_bytes, size);
+    if (VL_UNLIKELY(size > stats.m_maxSize.load(std::memory_order_relaxed))) {
+        stats.m_maxSize.store(size, std::memory_order_relaxed);
+    }
+    if (VL_UNLIKELY(sizeClass >= CLASSES)) {
+        vlFrameCount(stats.m_unpooled, 1);
+        return ::operator new(size);
+    }
+    void*& head = lists.m_heads[sizeClass];
+    if (head) {
+        vlFrameCount(stats.m_reuses, 1);
+        void* const framep = head;
+        head = *static_cast<void**>(framep);
+        return framep;
+    }
+    return ::operator new(sizeClass * GRANULE);
+}
+
+void VlCoroutineFramePool::deallocate(void* ptr, size_t size) noexcept {
+    const size_t sizeClass = (size + GRANULE - 1) / GRANULE;
+    if (VL_UNLIKELY(t_frameFreeListsGone)) {
+        Stats stats;
+        stats.m_frees = 1;
+        vlFrameStatsExited(stats);
+        ::operator delete(ptr);
+        return;
+    }
+    VlFrameFreeLists& lists = t_frameFreeLists;
+    vlFrameCount(lists.m_stats.m_frees, 1);
+    if (VL_UNLIKELY(sizeClass >= CLASSES)) {
+        ::operator delete(ptr);
+        return;
+    }
+    // Frames freed on another thread than they were allocated on just move to this thread
+    void*& head = lists.m_heads[sizeClass];
+    *static_cast<void**>(ptr) = head;
+    head = ptr;
+}
+
+VlCoroutineFramePool::Stats VlCoroutineFramePool::stats() VL_MT_SAFE {
+    VlFrameStatsRegistry& registry = vlFrameStatsRegistry();
+    const VerilatedLockGuard lock{registry.m_mutex};
+    Stats stats = registry.m_exited;
+    for (const VlFrameThreadStats* const threadStatsp : registry.m_threads) {
+        vlFrameStatsAdd(stats, vlFrameStatsLoad(*threadStatsp));
+    }
+    return stats;
+}
+
+void VlCoroutineFramePool::statsPrint() VL_MT_SAFE {
+    const Stats s = stats();
+    VL_PRINTF_MT("- Verilator: coroutine frames %" PRIu64 " allocated, %" PRIu64
+                 " reused, %" PRIu64 " live; average %" PRIu64 " bytes, largest %" PRIu64
+                 " bytes, %" PRIu64 " unpooled\n",
+                 s.m_allocs, s.m_reuses, s.m_allocs - s.m_frees,
+                 s.m_allocs ? s.m_bytes / s.m_allocs : 0, s.m_maxSize, s.m_unpooled);
+}
+
 //======================================================================
 // VlCoroutine:: Methods
 
@@ -156,18 +156,121 @@ public:
 
 enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 
+//=============================================================================
+// VlDelayQueue is a time-sorted queue of coroutine handles, implemented as a hierarchical timing
+// wheel. There is one level per byte of the time, each with a slot per byte value. An entry is
+// kept at the level of the most significant byte in which its time differs from the last popped
+// time, in the slot given by its time's byte at that level. Popping a time moves the other
+// entries in that time's slot down a level or more, so each entry moves at most LEVELS - 1
+// times. Entries are pooled, and slots are linked lists of pool indices, so once the pool has
+// grown pushing and popping does not allocate. Times pushed must not be before the last popped
+// time, which holds as simulation time does not go backwards.
+
+class VlDelayQueue final {
+    // TYPES
+    static constexpr int LEVELS = 8;  // One level per byte of the time
+    static constexpr int SLOTS = 256;  // One slot per byte value
+    static constexpr int WORDS = SLOTS / 64;  // Words in occupancy bitmap of a level
+    static constexpr uint32_t NONE = ~0U;  // Null pool index
+
+    struct Entry final {
+        uint64_t m_time;  // Time to resume at
+        uint64_t m_seq;  // Push order, to pop equal times first in, first out
+        uint32_t m_next = NONE;  // Next entry in slot, or next free entry
+        VlCoroutineHandle m_handle;  // Suspended coroutine, null once popped
+        Entry(uint64_t time, uint64_t seq, VlCoroutineHandle&& handle)
+            : m_time{time}
+            , m_seq{seq}
+            , m_handle{std::move(handle)} {}
+    };
+    struct Slot final {
+        uint32_t m_head = NONE;  // First entry
+        uint32_t m_tail = NONE;  // Last entry
+    };
+
+    // MEMBERS
+    std::vector<Entry> m_pool;  // Entry storage, popped entries are reused
+    uint32_t m_free = NONE;  // Head of list of popped entries in m_pool
+    Slot m_slots[LEVELS][SLOTS];  // Entries per level and slot
+    uint64_t m_occupied[LEVELS][WORDS] = {};  // Bitmap of non-empty m_slots
+    uint64_t m_now = 0;  // Last popped time, or earliest if pushed earlier
+    uint64_t m_next = ~0ULL;  // Earliest time in the queue, or ~0 if empty
+    uint64_t m_seq = 0;  // Next push sequence number
+    size_t m_size = 0;  // Number of entries in the queue
+    std::vector<uint32_t> m_popped;  // Entries being popped, kept to avoid reallocation
+
+    // METHODS
+    int levelOf(uint64_t time) const {
+        int level = 0;
+        for (uint64_t diff = (time ^ m_now) >> 8; diff; diff >>= 8) ++level;
+        return level;
+    }
+    static int slotOf(uint64_t time, int level) {
+        return static_cast<int>((time >> (8 * level)) & (SLOTS - 1));
+    }
+    void link(uint32_t index) {
+        Entry& entry = m_pool[index];
+        entry.m_next = NONE;
+        const int level = levelOf(entry.m_time);
+        const int slot = slotOf(entry.m_time, level);
+        Slot& slotr = m_slots[level][slot];
+        if (slotr.m_tail == NONE) {
+            slotr.m_head = index;
+            m_occupied[level][slot / 64] |= 1ULL << (slot % 64);
+        } else {
+            m_pool[slotr.m_tail].m_next = index;
+        }
+        slotr.m_tail = index;
+    }
+    uint32_t unlink(int level, int slot);
+    void rebase(uint64_t time);
+    uint64_t findNext() const;
+
+public:
+    // CONSTRUCTORS
+    VlDelayQueue() = default;
+    VL_UNCOPYABLE(VlDelayQueue);
+
+    // METHODS
+    bool empty() const { return m_size == 0; }
+    // Earliest time in the queue, or ~0 if empty
+    uint64_t nextTime() const { return m_next; }
+    // Add a coroutine to resume at the given time
+    void push(uint64_t time, VlCoroutineHandle&& handle) {
+        if (VL_UNLIKELY(time < m_now)) rebase(time);
+        uint32_t index;
+        if (m_free != NONE) {
+            index = m_free;
+            Entry& entry = m_pool[index];
+            m_free = entry.m_next;
+            entry.m_time = time;
+            entry.m_seq = m_seq++;
+            entry.m_handle = std::move(handle);
+        } else {
+            index = static_cast<uint32_t>(m_pool.size());
+            m_pool.emplace_back(time, m_seq++, std::move(handle));
+        }
+        link(index);
+        ++m_size;
+        if (time < m_next) m_next = time;
+    }
+    // Move all coroutines waiting for nextTime() to 'handles', in push order
+    void pop(std::vector<VlCoroutineHandle>& handles);
+#ifdef VL_DEBUG
+    void dump() const;
+#endif
+};
+
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
 
 class VlDelayScheduler final {
-    // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
-
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    VlDelayQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    std::vector<VlCoroutineHandle> m_resumed;  // Coroutines being resumed from m_queue. Kept as
+                                               // a field to avoid reallocation.
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
@@ -187,7 +290,7 @@ public:
     bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
-        return (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
+        return (!m_queue.empty() && (m_queue.nextTime() <= m_context.time()))
                || !m_zeroDelayed.empty();
     }
 #ifdef VL_DEBUG
@@ -198,7 +301,7 @@ public:
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
+            VlDelayQueue& queue;
             std::vector<VlCoroutineHandle>& queueZeroDelay;
             const uint64_t delay;
             const VlDelayPhase phase;
@@ -207,7 +310,7 @@ public:
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    queue.push(delay, VlCoroutineHandle{coro, process, fileline});
                 } else {
                     queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
                 }
@@ -415,6 +518,35 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool allocates coroutine frames. Frames are rounded up to a size class, a
+// multiple of GRANULE bytes, and freed frames are kept on a per-thread free list for their size
+// class, so that coroutines created repeatedly, e.g. forked processes, reuse frames rather than
+// calling the heap allocator. Frames larger than the largest size class are not pooled.
+
+class VlCoroutineFramePool final {
+public:
+    // TYPES
+    static constexpr size_t GRANULE = 64;  // Size class granularity in bytes
+    static constexpr size_t CLASSES = 64;  // Number of size classes
+    struct Stats final {
+        uint64_t m_allocs = 0;  // Frames allocated
+        uint64_t m_reuses = 0;  // Frames allocated from a free list
+        uint64_t m_frees = 0;  // Frames freed
+        uint64_t m_bytes = 0;  // Sum of requested sizes of frames allocated
+        uint64_t m_maxSize = 0;  // Largest frame size requested
+        uint64_t m_unpooled = 0;  // Frames allocated too large to be pooled
+    };
+
+    // METHODS
+    static void* allocate(size_t size);
+    static void deallocate(void* ptr, size_t size) noexcept;
+    // Statistics summed over all threads
+    static Stats stats() VL_MT_SAFE;
+    // Print statistics summary
+    static void statsPrint() VL_MT_SAFE;
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -428,6 +560,12 @@ private:
 
         ~VlPromise();
 
+        // Allocate coroutine frames from the frame pool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* ptr, size_t size) noexcept {
+            VlCoroutineFramePool::deallocate(ptr, size);
+        }
+
         VlCoroutine get_return_object() { return {this}; }
 
         // Never suspend at the start of the coroutine
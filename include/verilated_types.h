@@ -387,6 +387,17 @@ public:
     void setData(void* valuep, const std::string& rhs);
 };
 
+// Header of a raw $readmem image file.  The header is followed by m_count
+// elements, each m_bytes long, in the little-endian layout Verilator uses
+// for an unpacked array element of m_bits width.
+struct VlReadMemImageHeader final {
+    char m_magic[8];  // "VLMEMIMG", not NUL terminated
+    uint32_t m_bits;  // Bit width of each element
+    uint32_t m_bytes;  // Bytes per element (1, 2, 4, 8, or 4 * words)
+    uint64_t m_addr;  // Array address of first element
+    uint64_t m_count;  // Number of elements
+};
+
 class VlWriteMem final {
     const bool m_hex;  // Hex format
     const int m_bits;  // Bit width of values
@@ -1285,6 +1296,237 @@ void VL_WRITEMEM_N(bool hex, int bits, const std::string& filename,
     }
 }
 
+//===================================================================
+// Verilog associative array container with hashed storage
+// Used instead of VlAssocArray for integral keys when nothing in the model
+// depends on key order, see V3AssocHash. Only the methods that do not depend
+// on key order (V3AssocHash's unorderedMethod) are provided.
+// There are no multithreaded locks on this; the base variable must
+// be protected by other means
+//
+template <class T_Key, class T_Value>
+class VlHashAssocArray final {
+    static_assert(std::is_integral<T_Key>::value, "VlHashAssocArray needs integral keys");
+
+private:
+    // TYPES
+    using Entry = std::pair<T_Key, T_Value>;
+    struct Slot final {
+        T_Key m_key;  // Key of the entry, if not empty
+        uint32_t m_entry;  // Index of the entry in m_entries plus one, 0 if empty
+    };
+    static constexpr size_t MIN_SLOTS = 8;  // Power of two
+
+public:
+    class const_iterator final {
+        const VlHashAssocArray* m_arrayp;  // Array iterated
+        size_t m_slot;  // Slot of the current entry
+        void skipEmpty() {
+            while (m_slot < m_arrayp->m_slots.size() && !m_arrayp->m_slots[m_slot].m_entry) {
+                ++m_slot;
+            }
+        }
+
+    public:
+        const_iterator(const VlHashAssocArray* arrayp, size_t slot)
+            : m_arrayp{arrayp}
+            , m_slot{slot} {
+            skipEmpty();
+        }
+        const Entry& operator*() const {
+            return m_arrayp->m_entries[m_arrayp->m_slots[m_slot].m_entry - 1];
+        }
+        const Entry* operator->() const { return &operator*(); }
+        const_iterator& operator++() {
+            ++m_slot;
+            skipEmpty();
+            return *this;
+        }
+        bool operator==(const const_iterator& rhs) const { return m_slot == rhs.m_slot; }
+        bool operator!=(const const_iterator& rhs) const { return m_slot != rhs.m_slot; }
+    };
+
+private:
+    // MEMBERS
+    std::vector<Slot> m_slots;  // Open addressing table with linear probing
+    std::deque<Entry> m_entries;  // Entries, not moved so at() references stay valid
+    std::vector<uint32_t> m_freeEntries;  // Indices of erased entries in m_entries
+    int m_size = 0;  // Number of entries in the table
+    int m_shift = 64;  // Shift of the hash to the slot index, 64 - log2(m_slots.size())
+    T_Value m_defaultValue;  // Default value
+
+    // METHODS
+    size_t home(T_Key index) const {  // Fibonacci hashing, slot the probing starts at
+        return static_cast<size_t>((static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15ULL)
+                                   >> m_shift);
+    }
+    size_t mask() const { return m_slots.size() - 1; }
+    // Return slot holding the index, or m_slots.size() if none
+    size_t findSlot(T_Key index) const {
+        if (VL_UNLIKELY(m_slots.empty())) return 0;
+        for (size_t s = home(index);; s = (s + 1) & mask()) {
+            const Slot& slot = m_slots[s];
+            if (!slot.m_entry) return m_slots.size();
+            if (slot.m_key == index) return s;
+        }
+    }
+    const Entry* findEntry(T_Key index) const {
+        const size_t s = findSlot(index);
+        if (s == m_slots.size()) return nullptr;
+        return &m_entries[m_slots[s].m_entry - 1];
+    }
+    void place(T_Key index, uint32_t entry) {
+        size_t s = home(index);
+        while (m_slots[s].m_entry) s = (s + 1) & mask();
+        m_slots[s] = Slot{index, entry};
+    }
+    void grow() {
+        std::vector<Slot> oldSlots(m_slots.empty() ? MIN_SLOTS : m_slots.size() * 2, Slot{});
+        oldSlots.swap(m_slots);
+        --m_shift;
+        while ((size_t{1} << (64 - m_shift)) < m_slots.size()) --m_shift;
+        for (const Slot& slot : oldSlots) {
+            if (slot.m_entry) place(slot.m_key, slot.m_entry);
+        }
+    }
+    T_Value& insert(T_Key index) {
+        if (static_cast<size_t>(m_size + 1) * 2 > m_slots.size()) grow();
+        uint32_t entry;
+        if (!m_freeEntries.empty()) {
+            entry = m_freeEntries.back();
+            m_freeEntries.pop_back();
+            m_entries[entry] = Entry{index, m_defaultValue};
+        } else {
+            entry = static_cast<uint32_t>(m_entries.size());
+            m_entries.emplace_back(index, m_defaultValue);
+        }
+        place(index, entry + 1);
+        ++m_size;
+        return m_entries[entry].second;
+    }
+
+public:
+    // CONSTRUCTORS
+    // m_defaultValue isn't defaulted. Caller's constructor must do it.
+    VlHashAssocArray() = default;
+    ~VlHashAssocArray() = default;
+    VlHashAssocArray(const VlHashAssocArray&) = default;
+    VlHashAssocArray(VlHashAssocArray&&) = default;
+    VlHashAssocArray& operator=(const VlHashAssocArray&) = default;
+    VlHashAssocArray& operator=(VlHashAssocArray&&) = default;
+    bool operator==(const VlHashAssocArray& rhs) const {
+        if (m_size != rhs.m_size) return false;
+        for (const Entry& i : *this) {
+            const Entry* const rhsp = rhs.findEntry(i.first);
+            if (!rhsp || !(rhsp->second == i.second)) return false;
+        }
+        return true;
+    }
+    bool operator!=(const VlHashAssocArray& rhs) const { return !(*this == rhs); }
+
+    // METHODS
+    T_Value& atDefault() { return m_defaultValue; }
+    const T_Value& atDefault() const { return m_defaultValue; }
+
+    // Size of array. Verilog: function int size(), or int num()
+    int size() const { return m_size; }
+    // Clear array. Verilog: function void delete([input index])
+    void clear() {
+        m_slots.clear();
+        m_entries.clear();
+        m_freeEntries.clear();
+        m_size = 0;
+        m_shift = 64;
+    }
+    void erase(const T_Key& index) {
+        size_t s = findSlot(index);
+        if (s == m_slots.size()) return;
+        const uint32_t entry = m_slots[s].m_entry - 1;
+        m_entries[entry].second = T_Value{};  // Release any resources now
+        m_freeEntries.push_back(entry);
+        --m_size;
+        // Backward shift deletion, move later entries of the probe run into the hole
+        for (size_t next = (s + 1) & mask();; next = (next + 1) & mask()) {
+            const Slot& slot = m_slots[next];
+            if (!slot.m_entry) break;
+            // Entry can fill the hole if its home is not cyclically in (s, next]
+            if (((next - home(slot.m_key)) & mask()) >= ((next - s) & mask())) {
+                m_slots[s] = slot;
+                s = next;
+            }
+        }
+        m_slots[s].m_entry = 0;
+    }
+    // Return 0/1 if element exists. Verilog: function int exists(input index)
+    int exists(const T_Key& index) const { return findSlot(index) != m_slots.size(); }
+    // Setting. Verilog: assoc[index] = v
+    // Can't just overload operator[] or provide a "at" reference to set,
+    // because we need to be able to insert only when the value is set
+    T_Value& at(const T_Key& index) {
+        const size_t s = findSlot(index);
+        if (s == m_slots.size()) return insert(index);
+        return m_entries[m_slots[s].m_entry - 1].second;
+    }
+    // Accessing. Verilog: v = assoc[index]
+    const T_Value& at(const T_Key& index) const {
+        const Entry* const entryp = findEntry(index);
+        if (!entryp) return m_defaultValue;
+        return entryp->second;
+    }
+    // Setting as a chained operation
+    VlHashAssocArray& set(const T_Key& index, const T_Value& value) {
+        at(index) = value;
+        return *this;
+    }
+    VlHashAssocArray& setDefault(const T_Value& value) {
+        atDefault() = value;
+        return *this;
+    }
+
+    // For save/restore, in no particular order
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, m_slots.size()}; }
+
+    // Copy with key ordered storage, for dumping and $writemem
+    VlAssocArray<T_Key, T_Value> ordered() const {
+        VlAssocArray<T_Key, T_Value> out;
+        out.atDefault() = m_defaultValue;
+        for (const Entry& i : *this) out.at(i.first) = i.second;
+        return out;
+    }
+
+    // Dumping. Verilog: str = $sformatf("%p", assoc)
+    std::string to_string() const { return ordered().to_string(); }
+};
+
+template <class T_Key, class T_Value>
+std::string VL_TO_STRING(const VlHashAssocArray<T_Key, T_Value>& obj) {
+    return obj.to_string();
+}
+
+template <class T_Key, class T_Value>
+void VL_READMEM_N(bool hex, int bits, const std::string& filename,
+                  VlHashAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
+    VlReadMem rmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!rmem.isOpen())) return;
+    while (true) {
+        QData addr;
+        std::string data;
+        if (rmem.get(addr /*ref*/, data /*ref*/)) {
+            rmem.setData(&(obj.at(addr)), data);
+        } else {
+            break;
+        }
+    }
+}
+
+template <class T_Key, class T_Value>
+void VL_WRITEMEM_N(bool hex, int bits, const std::string& filename,
+                   const VlHashAssocArray<T_Key, T_Value>& obj, QData start,
+                   QData end) VL_MT_SAFE {
+    VL_WRITEMEM_N(hex, bits, filename, obj.ordered(), start, end);
+}
+
 //===================================================================
 /// Verilog unpacked array container
 /// For when a standard C++[] array is not sufficient, e.g. an
@@ -176,6 +176,9 @@ void VerilatedVcd::openNextImp(bool incFilename) {
         }
     }
     m_isOpen = true;
+    if (m_async && !m_asyncThreadp) {
+        m_asyncThreadp.reset(new std::thread{&VerilatedVcd::asyncWriterLoop, this});
+    }
     constDump(true);  // First dump must containt the const signals
     fullDump(true);  // First dump must be full
     m_wroteBytes = 0;
@@ -195,6 +198,12 @@ void VerilatedVcd::emitTimeChange(uint64_t timeui) {
 
 VerilatedVcd::~VerilatedVcd() {
     close();
+    asyncStop();
+    {
+        const VerilatedLockGuard lock{m_asyncMutex};
+        for (char* const bufp : m_asyncFree) delete[] bufp;
+        m_asyncFree.clear();
+    }
     if (m_wrBufp) VL_DO_CLEAR(delete[] m_wrBufp, m_wrBufp = nullptr);
     if (m_filep && m_fileNewed) VL_DO_CLEAR(delete m_filep, m_filep = nullptr);
     if (parallel()) {
@@ -209,6 +218,8 @@ void VerilatedVcd::closePrev() {
 
     Super::flushBase();
     bufferFlush();
+    asyncDrain();
+    if (VL_UNLIKELY(!isOpen())) return;  // Closed on a write error
     m_isOpen = false;
     m_filep->close();
 }
@@ -226,18 +237,22 @@ void VerilatedVcd::closeErr() {
 
 void VerilatedVcd::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     // This function is on the flush() call path
+    if (VL_UNLIKELY(m_asyncFailed)) return;  // Closed, see asyncReportError()
     const VerilatedLockGuard lock{m_mutex};
     if (!isOpen()) return;
     closePrev();
     // closePrev() called Super::flush(), so we just
-    // need to shut down the tracing thread here.
+    // need to shut down the tracing and writer threads here.
     Super::closeBase();
+    asyncStop();
 }
 
 void VerilatedVcd::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    if (VL_UNLIKELY(m_asyncFailed)) return;  // Closed, see asyncReportError()
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
     bufferFlush();
+    asyncDrain();
 }
 
 void VerilatedVcd::printStr(const char* str) {
@@ -252,6 +267,14 @@ void VerilatedVcd::bufferResize(size_t minsize) {
     // minsize is size of largest write.  We buffer at least 8 times as much data,
     // writing when we are 3/4 full (with thus 2*minsize remaining free)
     if (VL_UNLIKELY(minsize > m_wrChunkSize)) {
+        if (m_async) {
+            // Spare buffers would be too small, drop them
+            asyncDrain();
+            const VerilatedLockGuard lock{m_asyncMutex};
+            for (char* const bufp : m_asyncFree) delete[] bufp;
+            m_asyncNumBuffers -= m_asyncFree.size();
+            m_asyncFree.clear();
+        }
         const char* oldbufp = m_wrBufp;
         m_wrChunkSize = roundUpToMultipleOf<1024>(minsize * 2);
         m_wrBufp = new char[m_wrChunkSize * 8];
@@ -269,30 +292,132 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     // When it gets nearly full we dump it using this routine which calls write()
     // This is much faster than using buffered I/O
     if (VL_UNLIKELY(!m_isOpen)) return;
-    const char* wp = m_wrBufp;
+    if (m_async) {
+        asyncHandoff();
+        return;
+    }
+    const size_t len = m_writep - m_wrBufp;
+    const std::string error = bufferWrite(m_wrBufp, len);
+    if (VL_UNCOVERABLE(!error.empty())) {
+        VL_FATAL_MT("", 0, "", error.c_str());  // LCOV_EXCL_LINE
+        closeErr();  // LCOV_EXCL_LINE
+        return;  // LCOV_EXCL_LINE
+    }
+    m_wroteBytes += len;
+
+    // Reset buffer
+    m_writep = m_wrBufp;
+}
+
+std::string VerilatedVcd::bufferWrite(const char* bufp, size_t len) VL_MT_UNSAFE_ONE {
+    // Called from the thread doing the writing; returns an error message, empty if written
+    const char* wp = bufp;
+    const char* const endp = bufp + len;
     while (true) {
-        const ssize_t remaining = (m_writep - wp);
+        const ssize_t remaining = (endp - wp);
         if (remaining == 0) break;
         errno = 0;
         const ssize_t got = m_filep->write(wp, remaining);
         if (got > 0) {
             wp += got;
-            m_wroteBytes += got;
         } else if (VL_UNCOVERABLE(got < 0)) {
             if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
                 // LCOV_EXCL_START
                 // write failed, presume error (perhaps out of disk space)
-                const std::string msg = "VerilatedVcd::bufferFlush: "s + std::strerror(errno);
-                VL_FATAL_MT("", 0, "", msg.c_str());
-                closeErr();
-                break;
+                return "VerilatedVcd::bufferFlush: "s + std::strerror(errno);
                 // LCOV_EXCL_STOP
             }
         }
     }
+    return "";
+}
 
-    // Reset buffer
+void VerilatedVcd::asyncHandoff() VL_MT_UNSAFE_ONE {
+    // Queue the current output buffer for the writer thread, and continue
+    // in a spare one. Blocks only if all buffers are waiting to be written.
+    const size_t len = m_writep - m_wrBufp;
+    if (!len) return;
+    char* newBufp = nullptr;
+    {
+        const VerilatedLockGuard lock{m_asyncMutex};
+        m_asyncPending.emplace_back(m_wrBufp, len);
+        m_asyncCv.notify_all();
+        while (m_asyncFree.empty() && m_asyncNumBuffers >= ASYNC_MAX_BUFFERS) {
+            m_asyncCv.wait(m_asyncMutex);
+        }
+        if (!m_asyncFree.empty()) {
+            newBufp = m_asyncFree.back();
+            m_asyncFree.pop_back();
+        } else {
+            ++m_asyncNumBuffers;
+        }
+    }
+    if (!newBufp) newBufp = new char[m_wrChunkSize * 8];
+    m_wrBufp = newBufp;
+    m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
     m_writep = m_wrBufp;
+    m_wroteBytes += len;
+    asyncReportError();
+}
+
+void VerilatedVcd::asyncDrain() VL_MT_SAFE_EXCLUDES(m_asyncMutex) {
+    // Wait until the writer thread has written all queued buffers
+    if (!m_asyncThreadp) return;
+    {
+        const VerilatedLockGuard lock{m_asyncMutex};
+        while (!m_asyncPending.empty() || m_asyncBusy) m_asyncCv.wait(m_asyncMutex);
+    }
+    asyncReportError();
+}
+
+void VerilatedVcd::asyncReportError() VL_MT_SAFE_EXCLUDES(m_asyncMutex) {
+    // Report a write error from the writer thread on the dumping thread. The writer writes
+    // nothing more once it has failed, so the file may be closed here. This thread holds
+    // m_mutex, so flush() and close(), which vl_fatal calls back, must then do nothing.
+    std::string error;
+    {
+        const VerilatedLockGuard lock{m_asyncMutex};
+        if (VL_LIKELY(m_asyncError.empty())) return;
+        error.swap(m_asyncError);
+        m_asyncFailed = true;  // LCOV_EXCL_START
+    }
+    closeErr();
+    VL_FATAL_MT("", 0, "", error.c_str());
+}  // LCOV_EXCL_STOP
+
+void VerilatedVcd::asyncStop() VL_MT_SAFE_EXCLUDES(m_asyncMutex) {
+    if (!m_asyncThreadp) return;
+    {
+        const VerilatedLockGuard lock{m_asyncMutex};
+        m_asyncStop = true;
+        m_asyncCv.notify_all();
+    }
+    m_asyncThreadp->join();
+    m_asyncThreadp.reset();
+    const VerilatedLockGuard lock{m_asyncMutex};
+    m_asyncStop = false;
+}
+
+void VerilatedVcd::asyncWriterLoop() VL_MT_SAFE_EXCLUDES(m_asyncMutex) {
+    m_asyncMutex.lock();
+    while (true) {
+        while (m_asyncPending.empty() && !m_asyncStop) m_asyncCv.wait(m_asyncMutex);
+        if (m_asyncPending.empty()) break;  // Stopping, and all written
+        const std::pair<char*, size_t> item = m_asyncPending.front();
+        m_asyncPending.pop_front();
+        // After an error write nothing more, just return the buffers
+        const bool failed = m_asyncFailed || !m_asyncError.empty();
+        m_asyncBusy = true;
+        m_asyncMutex.unlock();
+        std::string error;
+        if (VL_LIKELY(!failed)) error = bufferWrite(item.first, item.second);
+        m_asyncMutex.lock();
+        if (VL_UNCOVERABLE(!error.empty())) m_asyncError = error;  // LCOV_EXCL_LINE
+        m_asyncBusy = false;
+        m_asyncFree.push_back(item.first);
+        m_asyncCv.notify_all();
+    }
+    m_asyncMutex.unlock();
 }
 
 //=============================================================================
@@ -577,6 +702,7 @@ void VerilatedVcdBuffer::finishLine(uint32_t code, char* writep) {
             m_owner.m_writep = m_writep;
             m_owner.bufferFlush();
             m_writep = m_owner.m_writep;
+            m_wrFlushp = m_owner.m_wrFlushp;
         }
     }
 }
@@ -24,6 +24,8 @@
 #include "verilated.h"
 #include "verilated_trace.h"
 
+#include <deque>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -69,8 +71,31 @@ private:
     std::vector<std::pair<char*, size_t>> m_freeBuffers;
     size_t m_numBuffers = 0;  // Number of trace buffers allocated
 
+    // Asynchronous writing, see asyncWrite(). Full output buffers are handed
+    // to a writer thread, and the model continues into a spare buffer.
+    static constexpr size_t ASYNC_MAX_BUFFERS = 4;  // Output buffers, including m_wrBufp
+    bool m_async = false;  // Write output on the writer thread
+    std::unique_ptr<std::thread> m_asyncThreadp;  // The writer thread
+    mutable VerilatedMutex m_asyncMutex;  // Protects m_async* below
+    std::condition_variable_any m_asyncCv;  // Signals change to m_async* below
+    // Buffers waiting to be written, as (pointer, used size) pairs
+    std::deque<std::pair<char*, size_t>> m_asyncPending VL_GUARDED_BY(m_asyncMutex);
+    std::vector<char*> m_asyncFree VL_GUARDED_BY(m_asyncMutex);  // Spare output buffers
+    size_t m_asyncNumBuffers VL_GUARDED_BY(m_asyncMutex) = 1;  // Output buffers allocated
+    bool m_asyncBusy VL_GUARDED_BY(m_asyncMutex) = false;  // Writer is writing a buffer
+    bool m_asyncStop VL_GUARDED_BY(m_asyncMutex) = false;  // Writer should exit
+    // Write error on the writer thread, reported by the dumping thread
+    std::string m_asyncError VL_GUARDED_BY(m_asyncMutex);
+    std::atomic<bool> m_asyncFailed{false};  // File closed after reporting m_asyncError
+
     void bufferResize(size_t minsize);
     void bufferFlush() VL_MT_UNSAFE_ONE;
+    std::string bufferWrite(const char* bufp, size_t len) VL_MT_UNSAFE_ONE;
+    void asyncHandoff() VL_MT_UNSAFE_ONE;
+    void asyncReportError() VL_MT_SAFE_EXCLUDES(m_asyncMutex);
+    void asyncDrain() VL_MT_SAFE_EXCLUDES(m_asyncMutex);
+    void asyncStop() VL_MT_SAFE_EXCLUDES(m_asyncMutex);
+    void asyncWriterLoop() VL_MT_SAFE_EXCLUDES(m_asyncMutex);
     void bufferCheck() {
         // Flush the write buffer if there's not enough space left for new information
         // We only call this once per vector, so we need enough slop for a very wide "b###" line
@@ -116,6 +141,13 @@ public:
     // ACCESSORS
     // Set size in bytes after which new file should be created.
     void rolloverSize(uint64_t size) VL_MT_SAFE { m_rolloverSize = size; }
+    // Write the file from a separate thread. Must be called before open(), ignored after, as
+    // the output buffers would not be handed back without the writer thread.
+    void asyncWrite(bool flag) VL_MT_SAFE {
+        VL_DEBUG_IFDEF(assert(!isOpen()););
+        if (isOpen()) return;
+        m_async = flag;
+    }
 
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
@@ -186,7 +218,8 @@ class VerilatedVcdBuffer VL_NOT_FINAL {
     // Write pointer into output buffer (in parallel mode, this is set up in 'getTraceBuffer')
     char* m_writep = m_owner.parallel() ? nullptr : m_owner.m_writep;
     // Output buffer flush trigger location (only used when not parallel)
-    char* const m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
+    // Not const, as with asyncWrite the owner switches output buffers on flush
+    char* m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
 
     // VCD line end string codes + metadata
     const char* const m_suffixes = m_owner.m_suffixes.data();
@@ -282,6 +315,9 @@ public:
     /// alignment to a start of a given time's dump).  Any file but the
     /// first may be removed.  Cat files together to create viewable vcd.
     void rolloverSize(size_t size) VL_MT_SAFE { m_sptrace.rolloverSize(size); }
+    /// Write the file from a separate thread, so dump() does not block on
+    /// file I/O. Must be called before open(), ignored after. Uses up to 4 output buffers.
+    void asyncWrite(bool flag) VL_MT_SAFE { m_sptrace.asyncWrite(flag); }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
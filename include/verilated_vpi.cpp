@@ -37,8 +37,8 @@
 #include <cstdio>
 #include <list>
 #include <map>
-#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -288,7 +288,6 @@ public:
 };
 
 class VerilatedVpioVar VL_NOT_FINAL : public VerilatedVpioVarBase {
-    uint8_t* m_prevDatap = nullptr;  // Previous value of data, for cbValueChange
     union {
         uint8_t u8[4];
         uint32_t u32;
@@ -312,14 +311,11 @@ public:
             m_entSize = varp->m_entSize;
             m_varDatap = varp->m_varDatap;
             m_index = varp->m_index;
-            // Not copying m_prevDatap, must be nullptr
         } else {
             m_mask.u32 = 0;
         }
     }
-    ~VerilatedVpioVar() override {
-        if (m_prevDatap) VL_DO_CLEAR(delete[] m_prevDatap, m_prevDatap = nullptr);
-    }
+    ~VerilatedVpioVar() override = default;
     static VerilatedVpioVar* castp(vpiHandle h) {
         return dynamic_cast<VerilatedVpioVar*>(reinterpret_cast<VerilatedVpio*>(h));
     }
@@ -336,14 +332,7 @@ public:
         }
         return (varp()->dims() > 1) ? vpiMemory : type;  // but might be wire, logic
     }
-    void* prevDatap() const { return m_prevDatap; }
     void* varDatap() const { return m_varDatap; }
-    void createPrevDatap() {
-        if (VL_UNLIKELY(!m_prevDatap)) {
-            m_prevDatap = new uint8_t[entSize()];
-            std::memcpy(prevDatap(), varp()->datap(), entSize());
-        }
-    }
 };
 
 class VerilatedVpioMemoryWord final : public VerilatedVpioVar {
@@ -603,12 +592,25 @@ public:
 
 using VerilatedPliCb = PLI_INT32 (*)(struct t_cb_data*);
 
+struct VerilatedVpiValueWatch final {
+    // Data watched by cbValueChange callbacks, shared by all callbacks on the same data,
+    // so a value is compared again in a callValueCbs() only if a callback ran since
+    const uint8_t* m_datap = nullptr;  // Data being watched
+    std::vector<uint8_t> m_prev;  // Value at last callValueCbs()
+    uint64_t m_checkStamp = 0;  // VerilatedVpiImp::m_valueCheckStamp when last compared
+    uint64_t m_changes = 0;  // Number of changes found, compared to each callback's count
+    uint32_t m_refs = 0;  // Number of callbacks using this
+    bool m_changed = false;  // Changed in the current callValueCbs()
+};
+
 class VerilatedVpiCbHolder final {
     // Holds information needed to call a callback
     uint64_t m_id;  // Unique id/sequence number to find schedule's event, 0 = invalid
     s_cb_data m_cbData;
     s_vpi_value m_value;
     VerilatedVpioVar m_varo;  // If a cbValueChange callback, the object we will return
+    VerilatedVpiValueWatch* m_watchp = nullptr;  // If a cbValueChange callback, data watched
+    uint64_t m_changesSeen = 0;  // m_watchp->m_changes when last called
 
 public:
     // cppcheck-suppress uninitVar  // m_value
@@ -620,7 +622,6 @@ public:
         m_cbData.value = &m_value;
         if (varop) {
             m_cbData.obj = m_varo.castVpiHandle();
-            m_varo.createPrevDatap();
         } else {
             m_cbData.obj = nullptr;
         }
@@ -631,6 +632,13 @@ public:
     uint64_t id() const { return m_id; }
     bool invalid() const { return !m_id; }
     void invalidate() { m_id = 0; }
+    VerilatedVpiValueWatch* watchp() const { return m_watchp; }
+    void watchp(VerilatedVpiValueWatch* watchp) {
+        m_watchp = watchp;
+        m_changesSeen = watchp->m_changes;
+    }
+    bool watchChanged() const { return m_watchp && m_changesSeen != m_watchp->m_changes; }
+    void watchSeen() { m_changesSeen = m_watchp->m_changes; }
 };
 
 class VerilatedVpiPutHolder final {
@@ -789,12 +797,24 @@ class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
     using VpioFutureCbs = std::map<std::pair<QData, uint64_t>, VerilatedVpiCbHolder>;
+    // Watched data by (pointer, size)
+    using VpioValueWatches = std::map<std::pair<const void*, uint32_t>, VerilatedVpiValueWatch>;
 
     // All only medium-speed, so use singleton function
     // Callbacks that are past or at current timestamp
     std::array<VpioCbList, CB_ENUM_MAX_VALUE> m_cbCurrentLists;
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    VpioValueWatches m_valueWatches;  // Data watched by cbValueChange callbacks
+    // vpi_handle_by_name results by full name, valid for m_nameCacheContextp's
+    // scopes at m_nameCacheGeneration
+    std::unordered_map<std::string, std::pair<const VerilatedScope*, const VerilatedVar*>>
+        m_nameCache;
+    const VerilatedContext* m_nameCacheContextp = nullptr;  // Context m_nameCache is for
+    uint64_t m_nameCacheGeneration = 0;  // Scope name map generation m_nameCache is for
+    std::string m_nameKey;  // vpi_handle_by_name name, reused to avoid allocation
+    std::vector<VerilatedVpiValueWatch*> m_valueChanged;  // Watches changed, in callValueCbs()
+    uint64_t m_valueCheckStamp = 0;  // Changed when watched values may have changed
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
@@ -820,6 +840,47 @@ public:
         VerilatedVpioVar* varop = nullptr;
         if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
         s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
+        if (varop) s().m_cbCurrentLists[cb_data_p->reason].back().watchp(watchAdd(varop));
+    }
+    static VerilatedVpiValueWatch* watchAdd(const VerilatedVpioVar* varop) {
+        const uint8_t* const datap = static_cast<const uint8_t*>(varop->varDatap());
+        VerilatedVpiValueWatch& watch
+            = s().m_valueWatches[std::make_pair(datap, varop->entSize())];
+        if (!watch.m_refs++) {
+            watch.m_datap = datap;
+            watch.m_prev.assign(datap, datap + varop->entSize());
+        } else if (!watch.m_changed
+                   && std::memcmp(watch.m_prev.data(), datap, watch.m_prev.size()) != 0) {
+            // Count a change since the last callValueCbs() for the existing callbacks, and take
+            // the current value, so as with a new watch the new callback is not called for it
+            ++watch.m_changes;
+            std::memcpy(watch.m_prev.data(), datap, watch.m_prev.size());
+        }
+        return &watch;
+    }
+    static std::string& nameKey() { return s().m_nameKey; }
+    static bool nameFind(const std::string& name, const VerilatedScope*& scopepr,
+                         const VerilatedVar*& varpr) {
+        VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = contextp->impp()->scopeNameMapGeneration();
+        if (VL_UNLIKELY(s().m_nameCacheContextp != contextp
+                        || s().m_nameCacheGeneration != generation)) {
+            // Scopes were added or removed, so cached pointers may be stale
+            s().m_nameCache.clear();
+            s().m_nameCacheContextp = contextp;
+            s().m_nameCacheGeneration = generation;
+            return false;
+        }
+        const auto it = s().m_nameCache.find(name);
+        if (it == s().m_nameCache.end()) return false;
+        scopepr = it->second.first;
+        varpr = it->second.second;
+        return true;
+    }
+    static void nameInsert(const std::string& name, const VerilatedScope* scopep,
+                           const VerilatedVar* varp) {
+        // Only found names are inserted, as variables may be added to scopes later
+        s().m_nameCache.emplace(name, std::make_pair(scopep, varp));
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -924,38 +985,64 @@ public:
         assertOneCheck();
         VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
         bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
         if (cbObjList.empty()) return called;
+        // Each watched value is compared when its first callback is reached, so a change made
+        // by an earlier callback is seen in this call, as with a compare per callback. The
+        // result is reused until another callback runs. Each callback counts the changes it
+        // was called for, so one already passed in this call is called in the next.
+        std::vector<VerilatedVpiValueWatch*>& changed = s().m_valueChanged;
+        uint64_t& stamp = s().m_valueCheckStamp;
+        ++stamp;
+        bool removed = false;
         const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
         for (auto it = cbObjList.begin(); true;) {
             // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
             const bool was_last = it == last;
             if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
+                if (it->watchp()) {
+                    --it->watchp()->m_refs;
+                    removed = true;
+                }
                 it = cbObjList.erase(it);
                 if (was_last) break;
                 continue;
             }
             VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
-            void* const newDatap = varop->varDatap();
-            void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
-            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
-                                        varop->fullname(), *(static_cast<CData*>(newDatap)),
-                                        *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
-                                            ho.id(), varop->fullname(),
-                                            *(static_cast<CData*>(newDatap))););
-                update.insert(varop);
+            VerilatedVpiValueWatch* const watchp = ho.watchp();
+            if (watchp && !watchp->m_changed && watchp->m_checkStamp != stamp) {
+                watchp->m_checkStamp = stamp;
+                if (std::memcmp(watchp->m_prev.data(), watchp->m_datap, watchp->m_prev.size())
+                    != 0) {
+                    watchp->m_changed = true;
+                    ++watchp->m_changes;
+                    changed.push_back(watchp);
+                }
+            }
+            if (ho.watchChanged()) {
+                ho.watchSeen();
+                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s\n", ho.id(),
+                                            VerilatedVpioVar::castp(ho.cb_datap()->obj)
+                                                ->fullname()););
                 vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
                 (ho.cb_rtnp())(ho.cb_datap());
+                ++stamp;  // Callback may have changed watched values
                 called = true;
             }
             if (was_last) break;
         }
-        for (const auto& ip : update) {
-            std::memcpy(ip->prevDatap(), ip->varDatap(), ip->entSize());
+        for (VerilatedVpiValueWatch* const watchp : changed) {
+            watchp->m_changed = false;
+            std::memcpy(watchp->m_prev.data(), watchp->m_datap, watchp->m_prev.size());
+        }
+        changed.clear();
+        if (removed) {
+            for (auto it = s().m_valueWatches.begin(); it != s().m_valueWatches.end();) {
+                if (!it->second.m_refs) {
+                    it = s().m_valueWatches.erase(it);
+                } else {
+                    ++it;
+                }
+            }
         }
         return called;
     }
@@ -1083,6 +1170,102 @@ bool VerilatedVpi::evalNeeded() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::evalN
 
 void VerilatedVpi::doInertialPuts() VL_MT_UNSAFE_ONE { VerilatedVpiImp::doInertialPuts(); }
 
+static const VerilatedVpioVar* vl_batch_varp(vpiHandle handle, const char* funcp) {
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(handle);
+    if (VL_UNLIKELY(!vop)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", funcp, handle);
+        return nullptr;
+    }
+    // A whole unpacked array has more than the one element varDatap() points to
+    const int udims = vop->varp()->udims();
+    if (VL_UNLIKELY(udims && !(udims == 1 && VerilatedVpioMemoryWord::castp(handle)))) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Unsupported unpacked array %s, use a handle to each element", funcp,
+                      vop->fullname());
+        return nullptr;
+    }
+    switch (vop->varp()->vltype()) {
+    case VLVT_UINT8:
+    case VLVT_UINT16:
+    case VLVT_UINT32:
+    case VLVT_UINT64:
+    case VLVT_WDATA: return vop;
+    default:
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported type of %s, must be packed", funcp,
+                      vop->fullname());
+        return nullptr;
+    }
+}
+
+bool VerilatedVpi::getValues(const vpiHandle* handlesp, uint32_t count,
+                             uint32_t* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    for (uint32_t n = 0; n < count; ++n) {
+        const VerilatedVpioVar* const vop = vl_batch_varp(handlesp[n], __func__);
+        if (VL_UNLIKELY(!vop)) return false;
+        const void* const datap = vop->varDatap();
+        switch (vop->varp()->vltype()) {
+        case VLVT_UINT8: *bufp++ = *static_cast<const CData*>(datap); break;
+        case VLVT_UINT16: *bufp++ = *static_cast<const SData*>(datap); break;
+        case VLVT_UINT32: *bufp++ = *static_cast<const IData*>(datap); break;
+        case VLVT_UINT64: {
+            const QData data = *static_cast<const QData*>(datap);
+            *bufp++ = static_cast<uint32_t>(data);
+            *bufp++ = static_cast<uint32_t>(data >> 32ULL);
+            break;
+        }
+        default: {
+            const int words = VL_WORDS_I(vop->varp()->packed().elements());
+            std::memcpy(bufp, datap, words * sizeof(EData));
+            bufp += words;
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+bool VerilatedVpi::putValues(const vpiHandle* handlesp, uint32_t count,
+                             const uint32_t* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    // Check all handles first, so an error leaves the model unchanged
+    for (uint32_t n = 0; n < count; ++n) {
+        const VerilatedVpioVar* const vop = vl_batch_varp(handlesp[n], __func__);
+        if (VL_UNLIKELY(!vop)) return false;
+        if (VL_UNLIKELY(!vop->varp()->isPublicRW())) {
+            VL_VPI_ERROR_(__FILE__, __LINE__,
+                          "%s: Signal marked read-only, use public_flat_rw instead: %s",
+                          __func__, vop->fullname());
+            return false;
+        }
+    }
+    if (count) VerilatedVpiImp::evalNeeded(true);
+    for (uint32_t n = 0; n < count; ++n) {
+        const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(handlesp[n]);
+        void* const datap = vop->varDatap();
+        switch (vop->varp()->vltype()) {
+        case VLVT_UINT8: *static_cast<CData*>(datap) = *bufp++ & vop->mask(); break;
+        case VLVT_UINT16: *static_cast<SData*>(datap) = *bufp++ & vop->mask(); break;
+        case VLVT_UINT32: *static_cast<IData*>(datap) = *bufp++ & vop->mask(); break;
+        case VLVT_UINT64:
+            *static_cast<QData*>(datap) = VL_SET_QII(bufp[1] & vop->mask(), bufp[0]);
+            bufp += 2;
+            break;
+        default: {
+            const int words = VL_WORDS_I(vop->varp()->packed().elements());
+            EData* const wdatap = static_cast<EData*>(datap);
+            std::memcpy(wdatap, bufp, words * sizeof(EData));
+            wdatap[words - 1] &= vop->mask();
+            bufp += words;
+            break;
+        }
+        }
+    }
+    return true;
+}
+
 //======================================================================
 // VerilatedVpiImp implementation
 
@@ -1969,69 +2152,77 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     if (VL_UNLIKELY(!namep)) return nullptr;
     VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_handle_by_name %s %p\n", namep, scope););
     const VerilatedVar* varp = nullptr;
-    const VerilatedScope* scopep;
+    const VerilatedScope* scopep = nullptr;
     const VerilatedVpioScope* const voScopep = VerilatedVpioScope::castp(scope);
-    std::string scopeAndName = namep;
+    // Reused buffer, so repeated lookups of cached names do not allocate
+    std::string& scopeAndName = VerilatedVpiImp::nameKey();
     if (voScopep) {
         const bool scopeIsPackage = VerilatedVpioPackage::castp(scope) != nullptr;
-        scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
-        namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
+        scopeAndName = voScopep->fullname();
+        if (!scopeIsPackage) scopeAndName += '.';
+        scopeAndName += namep;
+    } else {
+        scopeAndName = namep;
     }
-    {
+    namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
+    if (!VerilatedVpiImp::nameFind(scopeAndName, scopep, varp)) {
         // This doesn't yet follow the hierarchy in the proper way
         bool isPackage = false;
         scopep = Verilated::threadContextp()->scopeFind(namep);
-        if (scopep) {  // Whole thing found as a scope
-            if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
-            } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            } else {
-                return (new VerilatedVpioScope{scopep})->castVpiHandle();
-            }
-        }
-        std::string basename = scopeAndName;
-        std::string scopename;
-        std::string::size_type prevpos = std::string::npos;
-        std::string::size_type pos = std::string::npos;
-        // Split hierarchical names at last '.' not inside escaped identifier
-        size_t i = 0;
-        while (i < scopeAndName.length()) {
-            if (scopeAndName[i] == '\\') {
-                while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
-                ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
-            } else {
-                while (i < scopeAndName.length()
-                       && (scopeAndName[i] != '.'
-                           && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
-                               || scopeAndName[i + 1] != ':')))
-                    ++i;
-                if (i < scopeAndName.length()) {
-                    prevpos = pos;
-                    pos = i++;
-                    if (scopeAndName[i - 1] == ':') isPackage = true;
+        if (!scopep) {  // Not whole thing found as a scope
+            std::string basename = scopeAndName;
+            std::string scopename;
+            std::string::size_type prevpos = std::string::npos;
+            std::string::size_type pos = std::string::npos;
+            // Split hierarchical names at last '.' not inside escaped identifier
+            size_t i = 0;
+            while (i < scopeAndName.length()) {
+                if (scopeAndName[i] == '\\') {
+                    while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
+                    ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+                } else {
+                    while (i < scopeAndName.length()
+                           && (scopeAndName[i] != '.'
+                               && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
+                                   || scopeAndName[i + 1] != ':')))
+                        ++i;
+                    if (i < scopeAndName.length()) {
+                        prevpos = pos;
+                        pos = i++;
+                        if (scopeAndName[i - 1] == ':') isPackage = true;
+                    }
                 }
             }
+            // Do the split
+            if (VL_LIKELY(pos != std::string::npos)) {
+                basename.erase(0, pos + (isPackage ? 2 : 1));
+                scopename = scopeAndName.substr(0, pos);
+                if (scopename == "$unit") scopename = "\\$unit ";
+            }
+            if (prevpos == std::string::npos) {
+                // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
+                scopep = Verilated::threadContextp()->scopeFind("TOP");
+                if (scopep) varp = scopep->varFind(basename.c_str());
+            }
+            if (!varp) {
+                scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
+                if (!scopep) return nullptr;
+                varp = scopep->varFind(basename.c_str());
+            }
+            if (!varp) return nullptr;
         }
-        // Do the split
-        if (VL_LIKELY(pos != std::string::npos)) {
-            basename.erase(0, pos + (isPackage ? 2 : 1));
-            scopename = scopeAndName.substr(0, pos);
-            if (scopename == "$unit") scopename = "\\$unit ";
-        }
-        if (prevpos == std::string::npos) {
-            // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
-            scopep = Verilated::threadContextp()->scopeFind("TOP");
-            if (scopep) varp = scopep->varFind(basename.c_str());
-        }
-        if (!varp) {
-            scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
-            if (!scopep) return nullptr;
-            varp = scopep->varFind(basename.c_str());
-        }
+        VerilatedVpiImp::nameInsert(scopeAndName, scopep, varp);
     }
-    if (!varp) return nullptr;
 
+    if (!varp) {  // Whole thing found as a scope
+        if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
+            return (new VerilatedVpioModule{scopep})->castVpiHandle();
+        } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
+            return (new VerilatedVpioPackage{scopep})->castVpiHandle();
+        } else {
+            return (new VerilatedVpioScope{scopep})->castVpiHandle();
+        }
+    }
     if (varp->isParam()) {
         return (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
     } else {
@@ -64,6 +64,18 @@ public:
     static void clearEvalNeeded() VL_MT_UNSAFE_ONE;
     /// Perform inertially delayed puts
     static void doInertialPuts() VL_MT_UNSAFE_ONE;
+    /// Read the values of count packed variable handles into bufp, in one call.
+    /// Each value is stored as (vpiSize + 31) / 32 words, least significant
+    /// word first, and values are concatenated in handle order.  Returns
+    /// false, with the vpi_chk_error() information set, on a bad handle,
+    /// including a handle to a whole unpacked array rather than an element.
+    static bool getValues(const vpiHandle* handlesp, uint32_t count,
+                          uint32_t* bufp) VL_MT_UNSAFE_ONE;
+    /// Write the values of count packed variable handles from bufp, in the
+    /// getValues() layout, as with vpi_put_value() using vpiNoDelay.
+    /// Returns false, without writing any value, on a bad or read-only handle.
+    static bool putValues(const vpiHandle* handlesp, uint32_t count,
+                          const uint32_t* bufp) VL_MT_UNSAFE_ONE;
 
     // Self test, for internal use only
     static void selfTest() VL_MT_UNSAFE_ONE;
@@ -0,0 +1,94 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Select hashed storage for associative arrays
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2024 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// ASSOCHASH TRANSFORMATIONS:
+//      Associative arrays are VlAssocArray, a std::map, by default.
+//      For each associative array C++ type with an integral key:
+//         If no method call on any array of that type depends on key
+//         order (first/next/foreach, find*, min, ...), mark the dtypes
+//         as hashed, so they are emitted as VlHashAssocArray.
+//      Decisions are per C++ type, not per dtype node, as different dtype
+//      nodes with the same C++ type are assigned and passed to each other.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3AssocHash.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+// Associative array usage, as a visitor of each AstNode
+
+class AssocHashVisitor final : public VNVisitorConst {
+    // STATE
+    // Associative array dtypes, with their C++ types (before marking)
+    std::vector<std::pair<AstAssocArrayDType*, std::string>> m_dtypes;
+    std::unordered_set<std::string> m_ordered;  // C++ types that need key order
+
+    // METHODS
+    static std::string cTypeOf(const AstNodeDType* dtypep) {
+        return dtypep->cType("", false, false);
+    }
+    // Return true if the method does not depend on key order, so works with hashed storage
+    static bool unorderedMethod(const std::string& name) {
+        static const std::unordered_set<std::string> s_names{
+            "at", "atDefault", "clear", "erase", "exists", "set", "setDefault", "size"};
+        return s_names.count(name);
+    }
+    static bool hashableKey(const AstAssocArrayDType* dtypep) {
+        const AstNodeDType* const keyp = dtypep->keyDTypep()->skipRefp();
+        return keyp->basicp() && keyp->isIntegralOrPacked() && !keyp->isWide();
+    }
+
+    // VISITORS
+    void visit(AstAssocArrayDType* nodep) override {
+        m_dtypes.emplace_back(nodep, cTypeOf(nodep));
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstCMethodHard* nodep) override {
+        const AstNodeDType* const fromDtp = nodep->fromp()->dtypep();
+        if (fromDtp && VN_IS(fromDtp->skipRefp(), AssocArrayDType)
+            && !unorderedMethod(nodep->name())) {
+            UINFO(9, "Ordered by " << nodep << endl);
+            m_ordered.insert(cTypeOf(fromDtp));
+        }
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit AssocHashVisitor(AstNetlist* nodep) {
+        iterateConst(nodep);
+        for (const auto& pair : m_dtypes) {
+            AstAssocArrayDType* const dtypep = pair.first;
+            if (!hashableKey(dtypep) || m_ordered.count(pair.second)) continue;
+            UINFO(8, "Hashed " << dtypep << endl);
+            dtypep->hashed(true);
+        }
+    }
+    ~AssocHashVisitor() override = default;
+};
+
+//######################################################################
+// AssocHash class functions
+
+void V3AssocHash::assocHashAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ": " << endl);
+    { AssocHashVisitor{nodep}; }
+    V3Global::dumpCheckGlobalTree("assochash", 0, dumpTreeEitherLevel() >= 6);
+}
@@ -19,6 +19,8 @@
 #include "V3Broken.h"
 #include "V3File.h"
 
+#include <atomic>
+#include <cstddef>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -906,7 +908,81 @@ void AstNode::deleteTree() {
 //======================================================================
 // Memory checks
 
-#ifdef VL_LEAK_CHECKS
+#ifndef VL_LEAK_CHECKS
+// AstNodes are allocated by bumping a pointer through large chunks, so
+// allocation is cheap, there is no per-object malloc header, and nodes
+// created together (e.g. parsing or cloning a module) are adjacent in
+// memory. Deleted nodes are kept on free lists per size class and reused.
+// Chunks are never returned, the netlist is not deleted at exit anyway.
+class AstNodeArena final {
+    // TYPES
+    struct FreeNode final {
+        FreeNode* m_nextp;
+    };
+    // CONSTANTS
+    static constexpr size_t GRANULE = alignof(std::max_align_t);  // Size class granularity
+    static constexpr size_t MAX_POOLED = 1024;  // Larger objects use the global allocator
+    static constexpr size_t NUM_CLASSES = MAX_POOLED / GRANULE + 1;
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;  // Bytes per arena chunk
+    // MEMBERS
+    FreeNode* m_freeps[NUM_CLASSES] = {};  // Free list heads, per size class
+    uint8_t* m_bumpp = nullptr;  // Next free byte in current chunk
+    uint8_t* m_endp = nullptr;  // End of current chunk
+
+public:
+    static std::atomic<uint64_t> s_chunkBytes;  // Total bytes in chunks, for statistics
+
+private:
+    static size_t sizeClass(size_t size) { return (size + GRANULE - 1) / GRANULE; }
+
+public:
+    void* allocate(size_t size) {
+        if (VL_UNLIKELY(size > MAX_POOLED)) return ::operator new(size);
+        const size_t sizeClass = AstNodeArena::sizeClass(size);
+        if (FreeNode* const freep = m_freeps[sizeClass]) {
+            m_freeps[sizeClass] = freep->m_nextp;
+            return freep;
+        }
+        const size_t bytes = sizeClass * GRANULE;
+        if (VL_UNLIKELY(m_bumpp + bytes > m_endp)) {
+            m_bumpp = static_cast<uint8_t*>(::operator new(CHUNK_SIZE));
+            m_endp = m_bumpp + CHUNK_SIZE;
+            s_chunkBytes.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+        }
+        void* const resultp = m_bumpp;
+        m_bumpp += bytes;
+        return resultp;
+    }
+    void deallocate(void* objp, size_t size) {
+        if (VL_UNLIKELY(size > MAX_POOLED)) {
+            ::operator delete(objp);
+            return;
+        }
+        const size_t sizeClass = AstNodeArena::sizeClass(size);
+        FreeNode* const freep = static_cast<FreeNode*>(objp);
+        freep->m_nextp = m_freeps[sizeClass];
+        m_freeps[sizeClass] = freep;
+    }
+};
+
+std::atomic<uint64_t> AstNodeArena::s_chunkBytes{0};
+
+// Per thread, so no locking is needed. A node freed on a different thread
+// than it was allocated on simply moves to that thread's free list.
+static thread_local AstNodeArena s_nodeArena;
+
+void* AstNode::operator new(size_t size) { return s_nodeArena.allocate(size); }
+
+void AstNode::operator delete(void* objp, size_t size) {
+    if (!objp) return;
+    s_nodeArena.deallocate(objp, size);
+}
+
+uint64_t AstNode::arenaBytes() VL_MT_SAFE {
+    // Objects too large for the arena are not included, but are rare
+    return AstNodeArena::s_chunkBytes.load(std::memory_order_relaxed);
+}
+#else
 void* AstNode::operator new(size_t size) {
     // Optimization note: Aligning to cache line is a loss, due to lost packing
     AstNode* const objp = static_cast<AstNode*>(::operator new(size));
@@ -920,6 +996,8 @@ void AstNode::operator delete(void* objp, size_t size) {
     V3Broken::deleted(nodep);
     ::operator delete(objp);
 }
+
+uint64_t AstNode::arenaBytes() VL_MT_SAFE { return 0; }  // No arena with VL_LEAK_CHECKS
 #endif
 
 //======================================================================
@@ -2153,10 +2153,10 @@ public:
 
     // CONSTRUCTORS
     virtual ~AstNode() = default;
-#ifdef VL_LEAK_CHECKS
+    // Allocated from an arena, see V3Ast.cpp
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
-#endif
+    static uint64_t arenaBytes() VL_MT_SAFE;  // Bytes of memory reserved for AstNodes
 
     // CONSTANTS
     // The following are relative dynamic costs (~ execution cycle count) of various operations.
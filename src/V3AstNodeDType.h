@@ -284,6 +284,7 @@ class AstAssocArrayDType final : public AstNodeDType {
     //
     // @astgen ptr := m_refDTypep : Optional[AstNodeDType]  // Elements of this type (post-width)
     // @astgen ptr := m_keyDTypep : Optional[AstNodeDType]  // Keys of this type (post-width)
+    bool m_hashed = false;  // Emit with hashed storage, key order not needed (V3AssocHash)
 public:
     AstAssocArrayDType(FileLine* fl, VFlagChildDType, AstNodeDType* dtp, AstNodeDType* keyDtp)
         : ASTGEN_SUPER_AssocArrayDType(fl) {
@@ -309,7 +310,8 @@ public:
         const AstAssocArrayDType* const asamep = VN_DBG_AS(samep, AssocArrayDType);
         if (!asamep->subDTypep()) return false;
         if (!asamep->keyDTypep()) return false;
-        return (subDTypep() == asamep->subDTypep() && keyDTypep() == asamep->keyDTypep());
+        return (subDTypep() == asamep->subDTypep() && keyDTypep() == asamep->keyDTypep()
+                && m_hashed == asamep->m_hashed);
     }
     bool similarDType(const AstNodeDType* samep) const override {
         if (type() != samep->type()) return false;
@@ -334,6 +336,8 @@ public:
         return m_keyDTypep ? m_keyDTypep : keyChildDTypep();
     }
     void keyDTypep(AstNodeDType* nodep) { m_keyDTypep = nodep; }
+    bool hashed() const { return m_hashed; }
+    void hashed(bool flag) { m_hashed = flag; }
     // METHODS
     AstBasicDType* basicp() const override VL_MT_STABLE { return nullptr; }
     AstNodeDType* skipRefp() const override VL_MT_STABLE { return (AstNodeDType*)this; }
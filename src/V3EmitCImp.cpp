@@ -313,24 +313,39 @@ class EmitCImp final : EmitCFunc {
             // function. This gets around gcc slowness constructing all of the template
             // arguments.
             puts("void " + prefixNameProtect(m_modp) + "::__vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
+            if (v3Global.opt.coveragePerThread()) {
+                puts("VerilatedCovShardedCount countp");
+            } else {
+                puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+                puts("* countp");
+            }
+            puts(", bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp) "
                  "{\n");
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coveragePerThread()) {
+                puts("VerilatedCovShardedCount count32p = countp;\n");
+            } else if (v3Global.opt.threads() > 1) {
                 puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
                 puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
             } else {
                 puts("uint32_t* count32p = countp;\n");
             }
             // static doesn't need save-restore as is constant
-            puts("static uint32_t fake_zero_count = 0;\n");
+            puts(v3Global.opt.coveragePerThread() ? "static std::atomic<uint32_t>"
+                                                  : "static uint32_t");
+            puts(" fake_zero_count{0};\n");
             puts("std::string fullhier = std::string{VerilatedModule::name()} + hierp;\n");
             puts("if (!fullhier.empty() && fullhier[0] == '.') fullhier = fullhier.substr(1);\n");
             // Used for second++ instantiation of identical bin
-            puts("if (!enable) count32p = &fake_zero_count;\n");
-            puts("*count32p = 0;\n");
+            if (v3Global.opt.coveragePerThread()) {
+                // Single shard; the coverage item zeros all shards on insert
+                puts("if (!enable) count32p = "
+                     "VerilatedCovShardedCount{&fake_zero_count, 0, 1};\n");
+            } else {
+                puts("if (!enable) count32p = &fake_zero_count;\n");
+                puts("*count32p = 0;\n");
+            }
             puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), VerilatedModule::name(), "
                  "count32p,");
             puts("  \"filename\",filenamep,");
@@ -487,6 +487,11 @@ void EmitCSyms::emitSymHdr() {
         puts("bool __Vm_even_cycle__ico = false;\n");
         puts("bool __Vm_even_cycle__act = false;\n");
         puts("bool __Vm_even_cycle__nba = false;\n");
+        if (v3Global.opt.threadsScheduleDynamic()) {
+            puts("VlMTaskReadyQueue __Vm_readyq__ico;\n");
+            puts("VlMTaskReadyQueue __Vm_readyq__act;\n");
+            puts("VlMTaskReadyQueue __Vm_readyq__nba;\n");
+        }
     }
 
     if (v3Global.opt.profExec()) {
@@ -506,10 +511,15 @@ void EmitCSyms::emitSymHdr() {
 
     if (m_coverBins) {
         puts("\n// COVERAGE\n");
-        puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-        puts(" __Vcoverage[");
-        puts(cvtToStr(m_coverBins));
-        puts("];\n");
+        if (v3Global.opt.coveragePerThread()) {
+            puts("VlCoverageShards<" + cvtToStr(m_coverBins) + ", "
+                 + cvtToStr(v3Global.opt.threads()) + "> __Vcoverage;\n");
+        } else {
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(" __Vcoverage[");
+            puts(cvtToStr(m_coverBins));
+            puts("];\n");
+        }
     }
 
     if (v3Global.opt.profPgo()) {
@@ -742,6 +742,141 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     }
 }
 
+void implementExecGraphDynamic(AstExecGraph* const execGraphp) {
+    // With dynamic scheduling mtasks are not bound to threads. Each mtask
+    // becomes an entry point which on completion signals all its successors
+    // and pushes the ones that became ready onto a shared run-time ready
+    // queue. All threads, including the main thread, then greedily execute
+    // mtasks from the ready queue until the whole graph is done.
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string queueName = "vlSymsp->__Vm_readyq__" + tag;
+
+    // Higher priority (longer path to the end of the graph) first
+    const auto byPriority = [](const ExecMTask* ap, const ExecMTask* bp) {
+        if (ap->priority() != bp->priority()) return ap->priority() > bp->priority();
+        return ap->id() < bp->id();
+    };
+
+    // Create the entry point function for each mtask
+    std::vector<const ExecMTask*> mtasks;
+    std::unordered_map<const ExecMTask*, AstCFunc*> funcps;
+    for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
+        const ExecMTask* const mtaskp = vtx.as<ExecMTask>();
+        const string name{"__Vmtask__" + tag + "__" + cvtToStr(mtaskp->id())};
+        AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        mtasks.push_back(mtaskp);
+        funcps.emplace(mtaskp, funcp);
+    }
+    std::stable_sort(mtasks.begin(), mtasks.end(), byPriority);
+
+    // Ready queue priority band of an mtask, 0 holds the mtasks with the
+    // longest path to the end of the graph. Must match VlMTaskReadyQueue::BANDS.
+    constexpr uint64_t nBands = 4;
+    const uint64_t maxPriority = mtasks.empty() ? 0 : mtasks.front()->priority();
+    const auto bandOf = [&](const ExecMTask* mtaskp) -> uint64_t {
+        return (maxPriority - mtaskp->priority()) * nBands / (maxPriority + 1);
+    };
+
+    // Statement pushing the given mtask onto the ready queue
+    const auto makePush = [&](const string& prefix, const ExecMTask* mtaskp) -> AstNode* {
+        AstNode* const stmtp = new AstText{fl, prefix + queueName + ".push(", true};
+        stmtp->addNext(new AstAddrOfCFunc{fl, funcps.at(mtaskp)});
+        stmtp->addNext(new AstText{fl, ", " + cvtToStr(bandOf(mtaskp)) + ");\n", true});
+        return new AstCStmt{fl, stmtp};
+    };
+
+    std::vector<const ExecMTask*> roots;
+    for (const ExecMTask* const mtaskp : mtasks) {
+        AstCFunc* const funcp = funcps.at(mtaskp);
+        const auto addStrStmt = [=](const string& stmt) -> void {  //
+            funcp->addStmtsp(new AstCStmt{fl, stmt});
+        };
+
+        // Setup vlSelf an vlSyms
+        addStrStmt(EmitCBase::voidSelfAssign(modp));
+        addStrStmt(EmitCBase::symClassAssign());
+
+        // Every dependency is tracked, as any thread might run any mtask
+        if (const uint32_t nDependencies = mtaskp->inEdges().size()) {
+            const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+            AstBasicDType* const mtaskStateDtypep
+                = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+            AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, mtaskStateDtypep};
+            varp->valuep(new AstConst{fl, nDependencies});
+            varp->protect(false);  // Do not protect as we still have references in AstText
+            modp->addStmtsp(varp);
+        } else {
+            roots.push_back(mtaskp);
+        }
+
+        if (v3Global.opt.profPgo()) {
+            // No lock around startCounter, as each counter is used by a single mtask
+            addStrStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                       + ");\n");
+        }
+
+        // Move the actual body into this function
+        funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+
+        if (v3Global.opt.profPgo()) {
+            addStrStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                       + ");\n");
+        }
+
+        // Signal each successor, making it ready if this was its last dependency
+        std::vector<const ExecMTask*> nexts;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            nexts.push_back(edge.top()->as<ExecMTask>());
+        }
+        std::stable_sort(nexts.begin(), nexts.end(), byPriority);
+        for (const ExecMTask* const nextp : nexts) {
+            funcp->addStmtsp(makePush("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                                          + ".signalUpstreamDone(even_cycle)) ",
+                                      nextp));
+        }
+
+        // Retire this mtask
+        addStrStmt(queueName + ".done();\n");
+    }
+
+    // Start the graph at the point this AstExecGraph is located in the tree
+    const auto addStrStmt = [=](const string& stmt) -> void {  //
+        execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+
+    if (v3Global.opt.profExec()) {
+        addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).execGraphBegin();\n");
+    }
+
+    const string evenCycle = "vlSymsp->__Vm_even_cycle__" + tag;
+    addStrStmt(evenCycle + " = !" + evenCycle + ";\n");
+
+    const uint32_t nMTasks = mtasks.size();
+    const uint32_t nHelpers = std::min<uint32_t>(v3Global.opt.threads() - 1, nMTasks - 1);
+    addStrStmt(queueName + ".start(vlSelf, " + evenCycle + ", " + cvtToStr(nMTasks) + ", "
+               + cvtToStr(nHelpers) + ");\n");
+    for (const ExecMTask* const mtaskp : roots) execGraphp->addStmtsp(makePush("", mtaskp));
+
+    // Worker threads help execute the ready queue, the main thread too
+    for (uint32_t i = 0; i < nHelpers; ++i) {
+        addStrStmt("vlSymsp->__Vm_threadPoolp->workerp(" + cvtToStr(i)
+                   + ")->addTask(&VlMTaskReadyQueue::helperTask, &" + queueName + ");\n");
+    }
+    addStrStmt(queueName + ".execute();\n");
+    addStrStmt("Verilated::mtaskId(0);\n");
+
+    if (v3Global.opt.profExec()) {
+        addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).execGraphEnd();\n");
+    }
+}
+
 void wrapMTaskBodies(AstExecGraph* const execGraphp) {
     FileLine* const flp = execGraphp->fileline();
     const string& tag = execGraphp->name();
@@ -823,7 +958,12 @@ void implement(AstNetlist* netlistp) {
         wrapMTaskBodies(execGraphp);
 
         // Replace the graph body with its multi-threaded implementation.
-        implementExecGraph(execGraphp, schedule);
+        // The dynamic schedule still uses the static one for profiling predictions.
+        if (v3Global.opt.threadsScheduleDynamic()) {
+            if (!execGraphp->depGraphp()->empty()) implementExecGraphDynamic(execGraphp);
+        } else {
+            implementExecGraph(execGraphp, schedule);
+        }
     });
 }
 
@@ -109,6 +109,14 @@ class V3FileDependImp final {
     std::set<string> m_filenameSet VL_GUARDED_BY(m_mutex);  // Files generated (elim duplicates)
     std::set<DependFile> m_filenameList;  // Files sourced/generated
 
+    static string contentHash(const string& filename) {
+        // Hash of file contents, so touched but unchanged sources can be detected
+        std::ifstream ifs{filename, std::ios::binary};
+        if (ifs.fail()) return "-";
+        std::ostringstream contents;
+        contents << ifs.rdbuf();
+        return VHashSha256{contents.str()}.digestHex();
+    }
     static string stripQuotes(const string& in) {
         string pretty = in;
         string::size_type pos;
@@ -141,6 +149,11 @@ public:
 
 V3FileDependImp dependImp;  // Depend implementation class
 
+static const char* const DAT_HEADER
+    = "# DESCR"
+      "IPTION: Verilator output: Timestamp and content data for --skip-identical.  Delete at "
+      "will.";
+
 //######################################################################
 // V3FileDependImp
 
@@ -182,8 +195,7 @@ void V3FileDependImp::writeTimes(const string& filename, const string& cmdlineIn
     if (ofp->fail()) v3fatal("Can't write " << filename);
 
     const string cmdline = stripQuotes(cmdlineIn);
-    *ofp << "# DESCR"
-         << "IPTION: Verilator output: Timestamp data for --skip-identical.  Delete at will.\n";
+    *ofp << DAT_HEADER << "\n";
     *ofp << "C \"" << cmdline << "\"\n";
 
     for (std::set<DependFile>::iterator iter = m_filenameList.begin();
@@ -207,6 +219,9 @@ void V3FileDependImp::writeTimes(const string& filename, const string& cmdlineIn
         *ofp << " " << std::setw(11) << iter->cnstime();
         *ofp << " " << std::setw(11) << iter->mstime();
         *ofp << " " << std::setw(11) << iter->mnstime();
+        // Targets (and Verilator itself) are checked only by stats, sources also by contents
+        const bool hashed = !iter->target() && iter->filename() != v3Global.opt.buildDepBin();
+        *ofp << " " << (hashed ? contentHash(iter->filename()) : "-");
         *ofp << " \"" << iter->filename() << "\"";
         *ofp << '\n';
     }
@@ -219,8 +234,10 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
         return false;
     }
     {
-        const string ignore = V3Os::getline(*ifp);
-        if (ignore.empty()) { /*used*/
+        const string header = V3Os::getline(*ifp);
+        if (header != DAT_HEADER) {
+            UINFO(2, "   --check-times failed: different file format\n");
+            return false;
         }
     }
     {
@@ -252,6 +269,8 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
         *ifp >> chkMstime;
         time_t chkMnstime;
         *ifp >> chkMnstime;
+        string chkHash;
+        *ifp >> chkHash;
         char quote;
         *ifp >> quote;
         const string chkFilename = V3Os::getline(*ifp, '"');
@@ -281,6 +300,11 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
                   && chkStat.st_mtime <= (chkMstime + 20)
                   // Not comparing chkMnstime
                   )) {
+                if (chkDir == 'S' && chkHash != "-" && chkHash == contentHash(chkFilename)) {
+                    // E.g. touched, or rewritten by a checkout, but the contents are the same
+                    UINFO(2, "   --check-times: same contents " << chkFilename << endl);
+                    continue;
+                }
                 UINFO(2, "   --check-times failed: out-of-date "
                              << chkFilename << "; " << chkStat.st_size << "=?" << chkSize << " "
                              << chkStat.st_ctime << "." << VL_STAT_CTIME_NSEC(chkStat) << "=?"
@@ -20,6 +20,7 @@
 // clang-format off
 #include "V3Error.h"
 #include "V3FileLine.h"
+#include "V3Hash.h"
 #include "V3Os.h"
 #include "V3String.h"
 #ifndef V3ERROR_NO_GLOBAL_
@@ -31,6 +32,7 @@
 // clang-format on
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <limits>
 #include <unordered_set>
@@ -314,12 +316,23 @@ FileLine* FileLine::copyOrSameFileLine() {
     // Return this, or a copy of this
     // There are often more than one token per line, thus we use the
     // same pointer as long as we're on the same line, file & warn state.
-    static FileLine* lastNewp = nullptr;
-    if (lastNewp && *lastNewp == *this) {  // Compares lineno, filename, etc
-        return lastNewp;
+    // The lexer and the parser interleave their calls, and tokens are
+    // revisited, so rather than just the last copy, keep a small hashed
+    // cache of recent copies, and reuse any that is equal.
+    static std::array<FileLine*, 256> s_recentps{};
+    V3Hash hash{static_cast<uint32_t>(m_filenameno)};
+    hash += m_firstLineno;
+    hash += m_firstColumn;
+    hash += m_lastLineno;
+    hash += m_lastColumn;
+    FileLine*& recentpr = s_recentps[hash.value() % s_recentps.size()];
+    if (recentpr && *recentpr == *this  // Compares lineno, filename, warn state, etc
+        && recentpr->m_contentp == m_contentp && recentpr->m_parent == m_parent
+        && recentpr->m_waive == m_waive && recentpr->m_contentLineno == m_contentLineno) {
+        return recentpr;
     }
     FileLine* const newp = new FileLine{this};
-    lastNewp = newp;
+    recentpr = newp;
     return newp;
 }
 
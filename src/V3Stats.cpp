@@ -140,6 +140,10 @@ public:
             }
         }
         addStat("Node memory TOTAL (MiB)", totalNodeMemoryUsage >> 20);
+        // Includes nodes deleted and not yet reused, and nodes not reachable from the netlist
+        if (const uint64_t arenaBytes = AstNode::arenaBytes()) {
+            addStat("Node memory arena reserved (MiB)", arenaBytes >> 20);
+        }
 
         // Node Memory usage
         for (int t = 0; t < VNType::_ENUM_END; ++t) {
@@ -148,6 +152,16 @@ public:
                 addStat("Node memory share (%), " + typeName(t), share, 2);
             }
         }
+        for (int t = 0; t < VNType::_ENUM_END; ++t) {
+            if (const uint64_t count = m_counters.m_statTypeCount[t]) {
+                addStat("Node memory (KiB), " + typeName(t), (count * typeSize(t)) >> 10);
+            }
+        }
+        for (int t = 0; t < VNType::_ENUM_END; ++t) {
+            if (m_counters.m_statTypeCount[t]) {
+                addStat("Node size (bytes), " + typeName(t), typeSize(t));
+            }
+        }
 
         // Expression combinations
         for (int t1 = 0; t1 < VNType::_ENUM_END; ++t1) {
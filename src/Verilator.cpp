@@ -20,6 +20,7 @@
 #include "V3ActiveTop.h"
 #include "V3Assert.h"
 #include "V3AssertPre.h"
+#include "V3AssocHash.h"
 #include "V3Ast.h"
 #include "V3Begin.h"
 #include "V3Branch.h"
@@ -549,6 +550,9 @@ static void process() {
             // Branch prediction
             V3Branch::branchAll(v3Global.rootp());
 
+            // Hashed storage for associative arrays not needing key order
+            if (v3Global.opt.fAssocHash()) V3AssocHash::assocHashAll(v3Global.rootp());
+
             // Add C casts when longs need to become long-long and vice-versa
             // Note depth may insert something needing a cast, so this must be last.
             V3Cast::castAll(v3Global.rootp());
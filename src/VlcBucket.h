@@ -20,6 +20,9 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <algorithm>
+#include <bitset>
+
 #ifndef V3ERROR_NO_GLOBAL_
 #define V3ERROR_NO_GLOBAL_
 #endif
@@ -37,6 +40,8 @@ class VlcBuckets final {
     uint64_t m_bucketsCovered = 0;  ///< Num buckets with sufficient coverage
 
     static uint64_t covBit(uint64_t point) { return 1ULL << (point & 63); }
+    static uint64_t countOnes(uint64_t word) { return std::bitset<64>{word}.count(); }
+    uint64_t words() const { return m_dataSize / 64; }  // m_dataSize is a multiple of 64
     uint64_t allocSize() const { return sizeof(uint64_t) * m_dataSize / 64; }
     void allocate(uint64_t point) {
         const uint64_t oldsize = m_dataSize;
@@ -97,22 +102,19 @@ public:
     }
     uint64_t popCount() const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) ++pop;
-        }
+        for (uint64_t i = 0; i < words(); ++i) pop += countOnes(m_datap[i]);
         return pop;
     }
-    uint64_t dataPopCount(const VlcBuckets& remaining) {
+    uint64_t dataPopCount(const VlcBuckets& remaining) const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && remaining.hits(i)) ++pop;
-        }
+        const uint64_t n = std::min(words(), remaining.words());
+        for (uint64_t i = 0; i < n; ++i) pop += countOnes(m_datap[i] & remaining.m_datap[i]);
         return pop;
     }
     void orData(const VlcBuckets& ordata) {
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && ordata.hits(i)) clearHits(i);
-        }
+        // Clear all points that ordata covers
+        const uint64_t n = std::min(words(), ordata.words());
+        for (uint64_t i = 0; i < n; ++i) m_datap[i] &= ~ordata.m_datap[i];
     }
 
     void dump() const {
@@ -69,6 +69,7 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
     DECL_OPTION("-debug", CbCall, []() { V3Error::debugDefault(3); });
     DECL_OPTION("-debugi", CbVal, [](int v) { V3Error::debugDefault(v); });
     DECL_OPTION("-rank", OnOff, &m_rank);
+    DECL_OPTION("-threads", Set, &m_threads);
     DECL_OPTION("-unlink", OnOff, &m_unlink);
     DECL_OPTION("-V", CbCall, []() {
         showVersion(true);
@@ -79,6 +80,7 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
         std::exit(0);
     });
     DECL_OPTION("-write", Set, &m_writeFile);
+    DECL_OPTION("-write-binary", Set, &m_writeBinaryFile);
     DECL_OPTION("-write-info", Set, &m_writeInfoFile);
     parser.finalize();
 
@@ -129,10 +131,7 @@ int main(int argc, char** argv) {
 
     if (top.opt.readFiles().empty()) top.opt.addReadFile("vlt_coverage.dat");
 
-    {
-        const VlStringSet& readFiles = top.opt.readFiles();
-        for (const auto& filename : readFiles) top.readCoverage(filename);
-    }
+    top.readCoverageFiles(top.opt.readFiles());
 
     if (debug() >= 9) {
         top.tests().dump(true);
@@ -147,8 +146,12 @@ int main(int argc, char** argv) {
         top.tests().dump(false);
     }
 
-    if (!top.opt.writeFile().empty() || !top.opt.writeInfoFile().empty()) {
+    if (!top.opt.writeFile().empty() || !top.opt.writeBinaryFile().empty()
+        || !top.opt.writeInfoFile().empty()) {
         if (!top.opt.writeFile().empty()) top.writeCoverage(top.opt.writeFile());
+        if (!top.opt.writeBinaryFile().empty()) {
+            top.writeCoverageBinary(top.opt.writeBinaryFile());
+        }
         if (!top.opt.writeInfoFile().empty()) top.writeInfo(top.opt.writeInfoFile());
         V3Error::abortIfWarnings();
         if (top.opt.unlink()) {
@@ -40,8 +40,10 @@ class VlcOptions final {
     bool m_annotatePoints = false;  // main switch: --annotate-points
     VlStringSet m_readFiles;    // main switch: --read
     bool m_rank = false;        // main switch: --rank
+    int m_threads = 0;          // main switch: --threads
     bool m_unlink = false;      // main switch: --unlink
     string m_writeFile;         // main switch: --write
+    string m_writeBinaryFile;   // main switch: --write-binary
     string m_writeInfoFile;     // main switch: --write-info
     // clang-format on
 
@@ -66,8 +68,10 @@ public:
     bool countOk(uint64_t count) const { return count >= static_cast<uint64_t>(m_annotateMin); }
     bool annotatePoints() const { return m_annotatePoints; }
     bool rank() const { return m_rank; }
+    unsigned threads() const { return m_threads < 0 ? 0 : m_threads; }
     bool unlink() const { return m_unlink; }
     string writeFile() const { return m_writeFile; }
+    string writeBinaryFile() const { return m_writeBinaryFile; }
     string writeInfoFile() const { return m_writeInfoFile; }
 
     // METHODS (from main)
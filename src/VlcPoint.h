@@ -20,8 +20,8 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <algorithm>
 #include <iomanip>
-#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -107,25 +107,48 @@ public:
 // VlcPoints - Container of all points
 
 class VlcPoints final {
+    // TYPES
+    using NameMap = std::unordered_map<string, uint64_t>;
+    using NameNum = std::pair<const string*, uint64_t>;
+
     // MEMBERS
-    using NameMap = std::map<const std::string, uint64_t>;  // Sorted by name (ordered)
     NameMap m_nameMap;  //< Name to point-number
     std::vector<VlcPoint> m_points;  //< List of all points
     uint64_t m_numPoints = 0;  //< Total unique points
+    std::vector<NameNum> m_byName;  //< Name to point-number, sorted by name, built lazily
 
     static int debug() { return V3Error::debugDefault(); }
 
+    void sortByName() {
+        if (m_byName.size() == m_nameMap.size()) return;
+        m_byName.clear();
+        m_byName.reserve(m_nameMap.size());
+        for (const auto& i : m_nameMap) m_byName.emplace_back(&i.first, i.second);
+        std::sort(m_byName.begin(), m_byName.end(), [](const NameNum& lhs, const NameNum& rhs) {
+            return *lhs.first < *rhs.first;
+        });
+    }
+
 public:
     // ITERATORS
-    using ByName = NameMap;
+    using ByName = std::vector<NameNum>;
     using iterator = ByName::iterator;
-    ByName::iterator begin() { return m_nameMap.begin(); }
-    ByName::iterator end() { return m_nameMap.end(); }
+    ByName::iterator begin() {
+        sortByName();
+        return m_byName.begin();
+    }
+    ByName::iterator end() {
+        sortByName();
+        return m_byName.end();
+    }
 
     // CONSTRUCTORS
     VlcPoints() = default;
     ~VlcPoints() = default;
 
+    // ACCESSORS
+    size_t size() const { return m_points.size(); }
+
     // METHODS
     void dump() {
         UINFO(2, "dumpPoints...\n");
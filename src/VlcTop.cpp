@@ -25,44 +25,118 @@
 
 #include <algorithm>
 #include <fstream>
+#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
 
-void VlcTop::readCoverage(const string& filename, bool nonfatal) {
-    UINFO(2, "readCoverage " << filename << endl);
-
-    std::ifstream is{filename.c_str()};
-    if (!is) {
-        if (!nonfatal) v3fatal("Can't read " << filename);
-        return;
-    }
+//######################################################################
+// VlcCoverageFile - Points parsed from one coverage file, not yet merged
+// Parsing touches only this object, so files may be parsed in parallel
+
+class VlcCoverageFile final {
+public:
+    // TYPES
+    enum Status : uint8_t { OK, UNREADABLE, CORRUPT };
+
+    // MEMBERS
+    string m_filename;  //< Name of the file
+    Status m_status = OK;  //< Parse result
+    std::vector<std::pair<string, uint64_t>> m_points;  //< Point names and hits, in file order
+
+    // METHODS
+    void parse() {
+        std::ifstream bis{m_filename.c_str(), std::ios::binary};
+        if (!bis) {
+            m_status = UNREADABLE;
+            return;
+        }
 
-    // Testrun and computrons argument unsupported as yet
-    VlcTest* const testp = tests().newTest(filename, 0, 0);
-
-    while (!is.eof()) {
-        const string line = V3Os::getline(is);
-        // UINFO(9," got "<<line<<endl);
-        if (line[0] == 'C') {
-            string::size_type secspace = 3;
-            for (; secspace < line.length(); secspace++) {
-                if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
+        char magic[VerilatedCovBinary::MAGIC_LEN];
+        bis.read(magic, sizeof(magic));
+        if (VerilatedCovBinary::isBinary(magic, bis.gcount())) {
+            bis.seekg(0, std::ios::end);
+            string data(static_cast<size_t>(bis.tellg()), '\0');
+            bis.seekg(0);
+            bis.read(&data[0], data.size());
+            if (!VerilatedCovBinary::read(data.data(), data.size(),
+                                          [&](const string& point, uint64_t hits) {
+                                              m_points.emplace_back(point, hits);
+                                          })) {
+                m_status = CORRUPT;
             }
-            const string point = line.substr(3, secspace - 3);
-            const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
-            // UINFO(9,"   point '"<<point<<"'"<<" "<<hits<<endl);
-
-            const uint64_t pointnum = points().findAddPoint(point, hits);
-            if (opt.rank()) {  // Only if ranking - uses a lot of memory
-                if (hits >= VlcBuckets::sufficient()) {
-                    points().pointNumber(pointnum).testsCoveringInc();
-                    testp->buckets().addData(pointnum, hits);
+            return;
+        }
+        bis.close();
+
+        std::ifstream is{m_filename.c_str()};
+        while (!is.eof()) {
+            const string line = V3Os::getline(is);
+            if (line[0] == 'C') {
+                string::size_type secspace = 3;
+                for (; secspace < line.length(); secspace++) {
+                    if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
                 }
+                const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
+                m_points.emplace_back(line.substr(3, secspace - 3), hits);
             }
         }
     }
+};
+
+//######################################################################
+
+void VlcTop::addCoveragePoint(VlcTest* testp, const string& point, uint64_t hits) {
+    const uint64_t pointnum = points().findAddPoint(point, hits);
+    if (testp) {  // Only if ranking - uses a lot of memory
+        if (hits >= VlcBuckets::sufficient()) {
+            points().pointNumber(pointnum).testsCoveringInc();
+            testp->buckets().addData(pointnum, hits);
+        }
+    }
+}
+
+void VlcTop::mergeCoverage(VlcCoverageFile& file) {
+    UINFO(2, "mergeCoverage " << file.m_filename << endl);
+    if (file.m_status == VlcCoverageFile::UNREADABLE) {
+        v3fatal("Can't read " << file.m_filename);
+        return;
+    }
+    if (file.m_status == VlcCoverageFile::CORRUPT) {
+        v3fatal("Corrupt binary coverage file " << file.m_filename);
+        return;
+    }
+
+    // Tests are only needed for ranking; without it don't hold per-file buckets
+    // Testrun and computrons argument unsupported as yet
+    VlcTest* const testp = opt.rank() ? tests().newTest(file.m_filename, 0, 0) : nullptr;
+    for (const auto& it : file.m_points) addCoveragePoint(testp, it.first, it.second);
+    // Release this file's points before the next is merged
+    std::vector<std::pair<string, uint64_t>>{}.swap(file.m_points);
+}
+
+void VlcTop::readCoverageFiles(const VlStringSet& filenames) {
+    const std::vector<string> names{filenames.begin(), filenames.end()};
+    unsigned threads = opt.threads();
+    if (!threads) threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::min<size_t>(threads, names.size());
+    UINFO(2, "readCoverageFiles " << names.size() << " files, " << threads << " threads" << endl);
+
+    // Parse a batch of files in parallel, then merge the batch in order.  Merging
+    // in command line order keeps point numbering, and so all output, independent
+    // of the thread count, and only one batch of parsed files is held in memory.
+    for (size_t base = 0; base < names.size(); base += threads) {
+        const size_t count = std::min<size_t>(threads, names.size() - base);
+        std::vector<VlcCoverageFile> files(count);
+        for (size_t i = 0; i < count; ++i) files[i].m_filename = names[base + i];
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < count; ++i) workers.emplace_back([&files, i]() { files[i].parse(); });
+        files[0].parse();
+        for (std::thread& worker : workers) worker.join();
+        for (VlcCoverageFile& file : files) mergeCoverage(file);
+    }
 }
 
 void VlcTop::writeCoverage(const string& filename) {
@@ -81,6 +155,24 @@ void VlcTop::writeCoverage(const string& filename) {
     }
 }
 
+void VlcTop::writeCoverageBinary(const string& filename) {
+    UINFO(2, "writeCoverageBinary " << filename << endl);
+
+    std::ofstream os{filename.c_str(), std::ios::binary | std::ios::out};
+    if (!os) {
+        v3fatal("Can't write " << filename);
+        return;
+    }
+
+    std::vector<std::pair<const string*, uint64_t>> points;
+    points.reserve(m_points.size());
+    for (const auto& i : m_points) {
+        const VlcPoint& point = m_points.pointNumber(i.second);
+        points.emplace_back(&point.name(), point.count());
+    }
+    VerilatedCovBinary::write(os, points);
+}
+
 void VlcTop::writeInfo(const string& filename) {
     UINFO(2, "writeInfo " << filename << endl);
 
@@ -173,33 +265,42 @@ void VlcTop::rank() {
         if (pointp->testsCovering()) remaining.addData(pointp->pointNum(), 1);
     }
 
-    // Additional Greedy algorithm
-    // O(n^2) Ouch.  Probably the thing to do is randomize the order of data
-    // then hierarchically solve a small subset of tests, and take resulting
-    // solution and move up to larger subset of tests.  (Aka quick sort.)
-    while (true) {
+    // Additional Greedy algorithm, evaluated lazily.  The number of points a test
+    // adds can only shrink as other tests are selected, so a score from an earlier
+    // iteration is an upper bound.  Only the best scored test needs rescoring; once
+    // its score is current it is the best choice.  Equal scores go to the earliest
+    // test by computrons, as a full scan would select.
+    struct RankEntry final {
+        uint64_t m_score;  // Points the test adds, as of iteration m_iter
+        uint64_t m_iter;  // Value of nextrank when m_score was computed
+        size_t m_index;  // Index into bytime
+    };
+    const auto rankCmp = [](const RankEntry& lhs, const RankEntry& rhs) {
+        if (lhs.m_score != rhs.m_score) return lhs.m_score < rhs.m_score;
+        return lhs.m_index > rhs.m_index;
+    };
+    std::priority_queue<RankEntry, std::vector<RankEntry>, decltype(rankCmp)> queue{rankCmp};
+    for (size_t i = 0; i < bytime.size(); ++i) {
+        queue.push({bytime[i]->buckets().dataPopCount(remaining), nextrank, i});
+    }
+    while (!queue.empty()) {
+        RankEntry best = queue.top();
+        if (!best.m_score) break;  // No test covering more stuff found
+        queue.pop();
+        VlcTest* const testp = bytime[best.m_index];
+        if (best.m_iter != nextrank) {  // Stale, rescore and requeue
+            best.m_score = testp->buckets().dataPopCount(remaining);
+            best.m_iter = nextrank;
+            queue.push(best);
+            continue;
+        }
         if (debug()) {
             UINFO(9, "Left on iter" << nextrank << ": ");  // LCOV_EXCL_LINE
             remaining.dump();  // LCOV_EXCL_LINE
         }
-        VlcTest* bestTestp = nullptr;
-        uint64_t bestRemain = 0;
-        for (const auto& testp : bytime) {
-            if (!testp->rank()) {
-                uint64_t remain = testp->buckets().dataPopCount(remaining);
-                if (remain > bestRemain) {
-                    bestTestp = testp;
-                    bestRemain = remain;
-                }
-            }
-        }
-        if (VlcTest* const testp = bestTestp) {
-            testp->rank(nextrank++);
-            testp->rankPoints(bestRemain);
-            remaining.orData(bestTestp->buckets());
-        } else {
-            break;  // No test covering more stuff found
-        }
+        testp->rank(nextrank++);
+        testp->rankPoints(best.m_score);
+        remaining.orData(testp->buckets());
     }
 }
 
@@ -25,6 +25,8 @@
 #include "VlcSource.h"
 #include "VlcTest.h"
 
+class VlcCoverageFile;
+
 //######################################################################
 // VlcTop - Top level options container
 
@@ -39,9 +41,11 @@ private:
     VlcSources m_sources;  //< List of all source files to annotate
 
     // METHODS
+    void addCoveragePoint(VlcTest* testp, const string& point, uint64_t hits);
     void annotateCalc();
     void annotateCalcNeeded();
     void annotateOutputFiles(const string& dirname);
+    void mergeCoverage(VlcCoverageFile& file);
 
 public:
     // CONSTRUCTORS
@@ -55,8 +59,9 @@ public:
 
     // METHODS
     void annotate(const string& dirname);
-    void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverageFiles(const VlStringSet& filenames);
     void writeCoverage(const string& filename);
+    void writeCoverageBinary(const string& filename);
     void writeInfo(const string& filename);
 
     void rank();
@@ -0,0 +1,58 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/);
+
+   // Key order not needed, hashed
+   int hashed[int];
+   int hashed_copy[int];
+   // Key order needed by foreach, ordered
+   shortint ordered[shortint];
+
+   string s;
+   int sum;
+
+   initial begin
+      for (int i = 0; i < 1000; i++) hashed[i * 7919] = i;
+      `checkh(hashed.size(), 1000);
+      `checkh(hashed.exists(7919 * 5), 1);
+      `checkh(hashed.exists(1), 0);
+      `checkh(hashed[7919 * 999], 999);
+      `checkh(hashed[1], 0);
+      for (int i = 0; i < 1000; i += 2) hashed.delete(i * 7919);
+      `checkh(hashed.size(), 500);
+      for (int i = 0; i < 1000; i++) `checkh(hashed.exists(i * 7919), i % 2);
+      for (int i = 1; i < 1000; i += 2) `checkh(hashed[i * 7919], i);
+
+      hashed_copy = hashed;
+      `checkh(hashed_copy == hashed, 1'b1);
+      hashed_copy[7919] = 0;
+      `checkh(hashed_copy == hashed, 1'b0);
+      hashed_copy.delete();
+      `checkh(hashed_copy.size(), 0);
+      hashed_copy[30] = 3;
+      hashed_copy[10] = 1;
+      hashed_copy[20] = 2;
+      s = $sformatf("%p", hashed_copy);
+      `checks(s, "'{'ha:'h1, 'h14:'h2, 'h1e:'h3} ");
+
+      ordered[3] = 30;
+      ordered[1] = 10;
+      ordered[2] = 20;
+      sum = 0;
+      foreach (ordered[k]) begin
+         sum = sum * 10 + int'(k);
+      end
+      `checkh(sum, 123);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
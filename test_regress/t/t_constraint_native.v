@@ -0,0 +1,58 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// These constraints are all simple enough for the built-in solver,
+// so no SMT solver is needed
+
+class Packet;
+   rand bit [7:0] kind;
+   rand bit [31:0] addr;
+   rand bit [31:0] limit;
+   rand bit [15:0] len;
+   rand bit [15:0] len_plus;
+   rand int signed offset;
+   rand bit [63:0] big;
+   int max_len;
+
+   constraint c_kind { kind inside {3, 8, [20:22]}; }
+   constraint c_addr { addr >= 'h1000; addr < limit; limit <= 'h2000; }
+   constraint c_len { len > 0; len <= max_len; len_plus == len + 1; }
+   constraint c_offset { offset > -10; offset < 10; offset != 0; }
+   constraint c_big { big > 64'hffff_ffff_ffff_fff0; }
+   constraint c_if { if (kind == 3) len < 4; }
+endclass
+
+module t (/*AUTOARG*/);
+
+   Packet p;
+   int seen_kind[int];
+   int seen_neg;
+
+   initial begin
+      p = new;
+      p.max_len = 100;
+      repeat (200) begin
+         if (p.randomize() != 1) $stop;
+         if (!(p.kind inside {3, 8, [20:22]})) $stop;
+         if (p.addr < 'h1000 || p.addr >= p.limit || p.limit > 'h2000) $stop;
+         if (p.len == 0 || p.len > 100 || p.len_plus != p.len + 1) $stop;
+         if (p.offset <= -10 || p.offset >= 10 || p.offset == 0) $stop;
+         if (p.big <= 64'hffff_ffff_ffff_fff0) $stop;
+         if (p.kind == 3 && p.len >= 4) $stop;
+         seen_kind[p.kind] = 1;
+         if (p.offset < 0) ++seen_neg;
+      end
+      if (seen_kind.num() != 5) $stop;
+      if (seen_neg == 0 || seen_neg == 200) $stop;
+
+      // Unsatisfiable on a single variable is detected without the solver
+      p.max_len = 0;
+      if (p.randomize() != 0) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
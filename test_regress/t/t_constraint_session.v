@@ -0,0 +1,61 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Solver state is kept between randomize() calls, check that constraints
+// do not leak between calls and classes
+
+class Bounded;
+   rand bit [15:0] x;
+   rand bit [15:0] y;
+   int limit;
+
+   constraint c_static { x < 100; }
+   constraint c_state { y == limit; }
+endclass
+
+class Other;
+   rand bit [15:0] x;
+
+   constraint c { x > 200; x < 300; }
+endclass
+
+module t (/*AUTOARG*/);
+
+   Bounded b;
+   Other o;
+
+   initial begin
+      b = new;
+      o = new;
+      for (int i = 0; i < 20; ++i) begin
+         b.limit = i * 7;
+         if (b.randomize() != 1) $stop;
+         if (b.x >= 100) $stop;
+         if (b.y != i * 7) $stop;
+         if (i % 5 == 4) begin
+            if (o.randomize() != 1) $stop;
+            if (o.x <= 200 || o.x >= 300) $stop;
+         end
+      end
+      // Drop the static constraint, it must not linger in the solver
+      b.c_static.constraint_mode(0);
+      b.limit = 3;
+      for (int i = 0; i < 100; ++i) begin
+         if (b.randomize() != 1) $stop;
+         if (b.y != 3) $stop;
+         if (b.x >= 100) break;
+      end
+      if (b.x < 100) $stop;
+      // Unsatisfiable, then satisfiable again
+      b.c_static.constraint_mode(1);
+      if (b.randomize() with { x > 100; } != 0) $stop;
+      if (b.randomize() != 1) $stop;
+      if (b.x >= 100) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_savable_incremental.v"
+test.pli_filename = "t/t_savable_incremental.cpp"
+
+test.compile(v_flags2=["--savable --exe -CFLAGS -DTEST_ASYNC", test.pli_filename],
+             make_main=False)
+
+test.execute()
+
+test.passes()
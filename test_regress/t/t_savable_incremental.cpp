@@ -0,0 +1,109 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <fstream>
+#include <memory>
+#include <vector>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static void cycles(VM_PREFIX* topp, int n) {
+    for (int i = 0; i < n; ++i) {
+        topp->clk = 1;
+        topp->eval();
+        topp->clk = 0;
+        topp->eval();
+    }
+}
+
+static void save(VerilatedSave& os, const std::string& filename, VM_PREFIX* topp,
+                 const std::vector<uint64_t>& data) {
+    os.open(filename);
+    TEST_CHECK_EQ(os.isOpen(), true);
+    os << *topp;
+    os.write(data.data(), data.size() * sizeof(uint64_t));
+    os.close();
+}
+
+static void restore(const std::string& filename, VM_PREFIX* topp, std::vector<uint64_t>& data) {
+    VerilatedRestore os;
+    os.open(filename);
+    TEST_CHECK_EQ(os.isOpen(), true);
+    os >> *topp;
+    os.read(data.data(), data.size() * sizeof(uint64_t));
+    os.close();
+}
+
+static long fileSize(const std::string& filename) {
+    std::ifstream is{filename.c_str(), std::ios::binary | std::ios::ate};
+    return static_cast<long>(is.tellg());
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    const std::string prefix = VL_STRINGIFY(TEST_OBJ_DIR) "/saved_";
+
+    // Incompressible user data, of which little changes between saves
+    std::vector<uint64_t> data(1 << 17);
+    uint64_t x = 1;
+    for (uint64_t& word : data) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        word = x;
+    }
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    cycles(topp.get(), 100);
+
+    VerilatedSave os;
+    os.compress(true);
+    os.incremental(true);
+#ifdef TEST_ASYNC
+    os.async(true);
+#endif
+    save(os, prefix + "1.vltsv", topp.get(), data);
+    cycles(topp.get(), 10);
+    data[12345] = 0;
+    save(os, prefix + "2.vltsv", topp.get(), data);
+    const std::vector<uint64_t> data2 = data;
+    const uint32_t cyc2 = topp->cyc;
+    const uint32_t sum2 = topp->sum;
+    cycles(topp.get(), 10);
+    os.asyncWait();
+
+    // Second save only holds the blocks that changed
+    TEST_CHECK_EQ(fileSize(prefix + "2.vltsv") * 4 < fileSize(prefix + "1.vltsv"), true);
+
+    // Restore refers back to the first save for unchanged blocks
+    const std::unique_ptr<VM_PREFIX> top2p{new VM_PREFIX{contextp.get(), "top2"}};
+    std::vector<uint64_t> data3(data.size());
+    restore(prefix + "2.vltsv", top2p.get(), data3);
+    TEST_CHECK_EQ(top2p->cyc, cyc2);
+    TEST_CHECK_EQ(top2p->sum, sum2);
+    TEST_CHECK_EQ(data3 == data2, true);
+    cycles(top2p.get(), 10);
+    TEST_CHECK_EQ(top2p->cyc, topp->cyc);
+    TEST_CHECK_EQ(top2p->sum, topp->sum);
+
+    topp->final();
+    top2p->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,24 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   cyc, sum,
+   // Inputs
+   clk
+   );
+   input clk;
+   output reg [31:0] cyc = 0;
+   output reg [31:0] sum = 0;
+
+   reg [31:0] mem [0:65535];
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      mem[cyc[15:0]] <= cyc * 32'h9e3779b9;
+      sum <= sum + mem[(cyc[15:0] * 7) & 16'hffff];
+   end
+endmodule
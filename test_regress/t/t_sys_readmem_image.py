@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2024 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import struct
+
+test.scenarios('simulator')
+
+MULT = 0x9e3779b97f4a7c15
+MASK64 = (1 << 64) - 1
+
+
+def gen_hex(filename):
+    # Large enough to be split across threads
+    with open(filename, 'w', encoding="utf8") as fh:
+        fh.write("// Generated by t_sys_readmem_image.py\n")
+        for i in range(0, 262144):
+            if i == 131072:
+                fh.write("@30000  # skip a hole\n")
+            if 131072 <= i < 196608:
+                continue
+            value = "%016x" % ((i * MULT) & MASK64)
+            fh.write(value[:8] + "_" + value[8:] + "\n")
+
+
+def gen_image(filename):
+    with open(filename, 'wb') as fh:
+        fh.write(b"VLMEMIMG" + struct.pack("<IIQQ", 72, 12, 16, 1024))
+        for i in range(16, 16 + 1024):
+            # Upper 24 bits are not part of the element, so must be ignored
+            value = (0xffffff << 72) | ((i & 0xff) << 64) | ((i * MULT) & MASK64)
+            fh.write(value.to_bytes(12, 'little'))
+
+
+gen_hex(test.obj_dir + "/t_sys_readmem_image_h.mem")
+gen_image(test.obj_dir + "/t_sys_readmem_image.bin")
+
+test.compile()
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define STRINGIFY(x) `"x`"
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t;
+
+   localparam MULT = 64'h9e3779b97f4a7c15;
+
+   reg [63:0] hex [0:262143];
+   reg [71:0] image [0:1039];
+   reg [63:0] exp64;
+   reg [71:0] exp72;
+
+   integer i;
+
+   initial begin
+      $readmemh({`STRINGIFY(`TEST_OBJ_DIR), "/t_sys_readmem_image_h.mem"}, hex);
+      for (i = 0; i < 262144; i = i + 1) begin
+         exp64 = (i >= 131072 && i < 196608) ? 64'h0 : 64'(i) * MULT;
+         `checkh(hex[i], exp64);
+      end
+
+      $readmemh({`STRINGIFY(`TEST_OBJ_DIR), "/t_sys_readmem_image.bin"}, image);
+      for (i = 0; i < 1040; i = i + 1) begin
+         exp72 = (i < 16) ? 72'h0 : {i[7:0], 64'(i) * MULT};
+         `checkh(image[i], exp72);
+      end
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
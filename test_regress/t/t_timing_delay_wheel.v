@@ -0,0 +1,50 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+`timescale 1ns/1ns
+
+// Delays spanning several bytes of the time, so the delay scheduler moves
+// processes between timing wheel levels, while still resuming processes
+// with equal times in the order they were delayed
+module t;
+   int order[$];
+   longint sum = 0;
+
+   initial begin #256 order.push_back(0); end
+   initial begin #300 order.push_back(1); #70000 order.push_back(3); end
+   initial begin #70300 order.push_back(2); end
+   initial begin
+      #200000 order.push_back(4);
+      #(64'h100_0000_0000 - 200000) order.push_back(6);
+   end
+   initial begin #(64'h100_0000_0000) order.push_back(5); end
+
+   // Many processes waking at assorted times
+   initial begin
+      for (int i = 0; i < 1000; ++i) begin
+         fork
+            automatic int j = i;
+            begin
+               #((j * 7919) % 100003) sum += j;
+               #((j * 104729) % 65537) sum += j;
+            end
+         join_none
+      end
+   end
+
+   initial begin
+      #(64'h100_0000_0000 + 1);
+      `checkh($time, 64'h100_0000_0001);
+      `checkh(order.size(), 7);
+      for (int i = 0; i < 7; ++i) `checkh(order[i], i);
+      `checkh(sum, 64'd999000);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,44 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_timing.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    {
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        while (!contextp->gotFinish()) {
+            topp->eval();
+            if (!topp->eventsPending()) break;
+            contextp->time(topp->nextTimeSlot());
+        }
+        topp->final();
+    }
+
+    const VlCoroutineFramePool::Stats stats = VlCoroutineFramePool::stats();
+    VlCoroutineFramePool::statsPrint();
+    TEST_CHECK_NE(stats.m_allocs, 0);
+    // Frames freed by earlier loop iterations are used by later ones
+    TEST_CHECK_NE(stats.m_reuses, 0);
+    TEST_CHECK_EQ(stats.m_allocs, stats.m_frees);
+    TEST_CHECK_NE(stats.m_maxSize, 0);
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2024 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   int counter = 0;
+
+   task automatic tick(int n);
+      #1 counter += n;
+   endtask
+
+   initial begin
+      // Each iteration creates and finishes coroutines, so frames get reused
+      for (int i = 0; i < 100; ++i) begin
+         fork
+            tick(1);
+            tick(2);
+         join
+      end
+      if (counter != 300) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('dist')
+
+# Merge order, and so the result, must not depend on the thread count
+for threads in ("1", "3"):
+    test.run(cmd=[
+        os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+        "--threads",
+        threads,
+        "--write",
+        test.obj_dir + "/coverage_" + threads + ".dat",
+        "t/t_vlcov_data_a.dat",
+        "t/t_vlcov_data_b.dat",
+        "t/t_vlcov_data_c.dat",
+        "t/t_vlcov_data_d.dat",
+    ],
+             verilator_run=True)
+
+    test.files_identical(test.obj_dir + "/coverage_" + threads + ".dat", "t/t_vlcov_merge.out")
+
+test.passes()
@@ -0,0 +1,30 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+import "DPI-C" context function int dpii_check();
+
+module t (/*AUTOARG*/);
+   reg [6:0] a /*verilator public_flat_rw*/;
+   reg [15:0] b /*verilator public_flat_rw*/;
+   reg [31:0] c /*verilator public_flat_rw*/;
+   reg [63:0] d /*verilator public_flat_rw*/;
+   reg [99:0] e /*verilator public_flat_rw*/;
+   reg [7:0] ro /*verilator public_flat_rd*/;
+   reg [7:0] mem [3:0] /*verilator public_flat_rw*/;
+
+   initial begin
+      a = 7'h12;
+      b = 16'h3456;
+      c = 32'h789abcde;
+      d = 64'h01234567_89abcdef;
+      e = 100'h9_87654321_fedcba98_76543210;
+      ro = 8'h5a;
+      mem[2] = 8'h33;
+      if (dpii_check() != 0) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
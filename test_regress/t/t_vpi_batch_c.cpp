@@ -0,0 +1,95 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "TestCheck.h"
+#include "TestVpi.h"
+
+#include <cstdio>
+
+#include "Vt_vpi_batch__Dpi.h"
+
+int errors = 0;
+
+//======================================================================
+
+int dpii_check() {
+    // Bad handles are tested, so report them through vpi_chk_error() only
+    Verilated::threadContextp()->fatalOnVpiError(false);
+
+    const char* const names[] = {"top.t.a", "top.t.b", "top.t.c", "top.t.d", "top.t.e"};
+    TestVpiHandle handles[5];
+    vpiHandle rawHandles[5];
+    for (int i = 0; i < 5; ++i) {
+        handles[i] = vpi_handle_by_name(const_cast<PLI_BYTE8*>(names[i]), NULL);
+        TEST_CHECK_NZ(handles[i]);
+        rawHandles[i] = handles[i];
+    }
+
+    // a, b, c: 1 word each, d: 2 words, e: 4 words
+    uint32_t buf[9] = {};
+    TEST_CHECK_EQ(VerilatedVpi::getValues(rawHandles, 5, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x12);
+    TEST_CHECK_HEX_EQ(buf[1], 0x3456);
+    TEST_CHECK_HEX_EQ(buf[2], 0x789abcde);
+    TEST_CHECK_HEX_EQ(buf[3], 0x89abcdef);
+    TEST_CHECK_HEX_EQ(buf[4], 0x01234567);
+    TEST_CHECK_HEX_EQ(buf[5], 0x76543210);
+    TEST_CHECK_HEX_EQ(buf[6], 0xfedcba98);
+    TEST_CHECK_HEX_EQ(buf[7], 0x87654321);
+    TEST_CHECK_HEX_EQ(buf[8], 0x9);
+
+    // Write all ones, which must be masked to each width
+    for (uint32_t& word : buf) word = 0xffffffff;
+    TEST_CHECK_EQ(VerilatedVpi::putValues(rawHandles, 5, buf), true);
+    for (uint32_t& word : buf) word = 0;
+    TEST_CHECK_EQ(VerilatedVpi::getValues(rawHandles, 5, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x7f);
+    TEST_CHECK_HEX_EQ(buf[1], 0xffff);
+    TEST_CHECK_HEX_EQ(buf[2], 0xffffffff);
+    TEST_CHECK_HEX_EQ(buf[4], 0xffffffff);
+    TEST_CHECK_HEX_EQ(buf[7], 0xffffffff);
+    TEST_CHECK_HEX_EQ(buf[8], 0xf);
+
+    // Read-only signals are rejected, and nothing is written
+    TestVpiHandle roh = vpi_handle_by_name(const_cast<PLI_BYTE8*>("top.t.ro"), NULL);
+    TEST_CHECK_NZ(roh);
+    vpiHandle mixed[2] = {rawHandles[0], roh};
+    const uint32_t zeros[2] = {0, 0};
+    TEST_CHECK_EQ(VerilatedVpi::putValues(mixed, 2, zeros), false);
+    s_vpi_error_info info;
+    TEST_CHECK_NZ(vpi_chk_error(&info));
+    TEST_CHECK_EQ(VerilatedVpi::getValues(mixed, 2, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x7f);
+    TEST_CHECK_HEX_EQ(buf[1], 0x5a);
+
+    // Whole unpacked arrays are rejected, their elements are accepted
+    TestVpiHandle memh = vpi_handle_by_name(const_cast<PLI_BYTE8*>("top.t.mem"), NULL);
+    TEST_CHECK_NZ(memh);
+    vpiHandle memArray[1] = {memh};
+    TEST_CHECK_EQ(VerilatedVpi::getValues(memArray, 1, buf), false);
+    TEST_CHECK_NZ(vpi_chk_error(&info));
+    TEST_CHECK_EQ(VerilatedVpi::putValues(memArray, 1, zeros), false);
+    TEST_CHECK_NZ(vpi_chk_error(&info));
+    TestVpiHandle wordh = vpi_handle_by_index(memh, 2);
+    TEST_CHECK_NZ(wordh);
+    vpiHandle memWord[1] = {wordh};
+    TEST_CHECK_EQ(VerilatedVpi::getValues(memWord, 1, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x33);
+    const uint32_t word[1] = {0x144};
+    TEST_CHECK_EQ(VerilatedVpi::putValues(memWord, 1, word), true);
+    TEST_CHECK_EQ(VerilatedVpi::getValues(memWord, 1, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x44);
+
+    return errors;
+}
@@ -0,0 +1,20 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+import "DPI-C" context function int dpii_check();
+
+module t (/*AUTOARG*/);
+   reg [7:0] a /*verilator public_flat_rw*/;
+   reg [7:0] b /*verilator public_flat_rw*/;
+
+   initial begin
+      a = 8'h10;
+      b = 8'h20;
+      if (dpii_check() != 0) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
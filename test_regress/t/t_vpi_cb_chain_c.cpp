@@ -0,0 +1,142 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "TestCheck.h"
+#include "TestVpi.h"
+
+#include <cstdio>
+
+#include "Vt_vpi_cb_chain__Dpi.h"
+
+int errors = 0;
+
+static vpiHandle s_bh = NULL;
+static int s_aCount = 0;
+static int s_bCount = 0;
+static int s_bEarlyCount = 0;
+static int s_bLateCount = 0;
+static PLI_INT32 s_bValue = 0;
+
+//======================================================================
+
+static PLI_INT32 a_changed(p_cb_data cb_data) {
+    ++s_aCount;
+    // Writing b must be reported to b's callback in the same callValueCbs()
+    s_vpi_value value;
+    value.format = vpiIntVal;
+    value.value.integer = cb_data->value->value.integer + 1;
+    vpi_put_value(s_bh, &value, NULL, vpiNoDelay);
+    return 0;
+}
+
+static PLI_INT32 b_changed(p_cb_data cb_data) {
+    ++s_bCount;
+    s_bValue = cb_data->value->value.integer;
+    return 0;
+}
+
+static PLI_INT32 b_early_changed(p_cb_data) {
+    ++s_bEarlyCount;
+    return 0;
+}
+
+static PLI_INT32 b_late_changed(p_cb_data) {
+    ++s_bLateCount;
+    return 0;
+}
+
+static vpiHandle register_cb(vpiHandle obj, PLI_INT32 (*cb_rtn)(p_cb_data)) {
+    static s_vpi_time t;
+    static s_vpi_value v;
+    t.type = vpiSuppressTime;
+    v.format = vpiIntVal;
+    s_cb_data cb_data;
+    cb_data.reason = cbValueChange;
+    cb_data.cb_rtn = cb_rtn;
+    cb_data.obj = obj;
+    cb_data.time = &t;
+    cb_data.value = &v;
+    cb_data.index = 0;
+    cb_data.user_data = NULL;
+    return vpi_register_cb(&cb_data);
+}
+
+int dpii_check() {
+    TestVpiHandle ah = vpi_handle_by_name(const_cast<PLI_BYTE8*>("top.t.a"), NULL);
+    TEST_CHECK_NZ(ah);
+    TestVpiHandle bh = vpi_handle_by_name(const_cast<PLI_BYTE8*>("top.t.b"), NULL);
+    TEST_CHECK_NZ(bh);
+    s_bh = bh;
+
+    // b_early_changed is checked before a's callback runs, b_changed after it
+    TestVpiHandle bearlycb = register_cb(bh, b_early_changed);
+    TEST_CHECK_NZ(bearlycb);
+    TestVpiHandle acb = register_cb(ah, a_changed);
+    TEST_CHECK_NZ(acb);
+    TestVpiHandle bcb = register_cb(bh, b_changed);
+    TEST_CHECK_NZ(bcb);
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), false);
+
+    s_vpi_value value;
+    value.format = vpiIntVal;
+    value.value.integer = 0x40;
+    vpi_put_value(ah, &value, NULL, vpiNoDelay);
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+    TEST_CHECK_EQ(s_aCount, 1);
+    TEST_CHECK_EQ(s_bCount, 1);
+    TEST_CHECK_HEX_EQ(s_bValue, 0x41);
+    TEST_CHECK_EQ(s_bEarlyCount, 0);
+
+    // The change to b was already passed by b_early_changed, so it is reported next
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+    TEST_CHECK_EQ(s_aCount, 1);
+    TEST_CHECK_EQ(s_bCount, 1);
+    TEST_CHECK_EQ(s_bEarlyCount, 1);
+
+    // Nothing changed since, so nothing is reported again
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), false);
+    TEST_CHECK_EQ(s_aCount, 1);
+    TEST_CHECK_EQ(s_bCount, 1);
+    TEST_CHECK_EQ(s_bEarlyCount, 1);
+
+    // A callback registered after a change is not called for it, the others are
+    value.value.integer = 0x50;
+    vpi_put_value(bh, &value, NULL, vpiNoDelay);
+    TestVpiHandle blatecb = register_cb(bh, b_late_changed);
+    TEST_CHECK_NZ(blatecb);
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+    TEST_CHECK_EQ(s_bCount, 2);
+    TEST_CHECK_HEX_EQ(s_bValue, 0x50);
+    TEST_CHECK_EQ(s_bEarlyCount, 2);
+    TEST_CHECK_EQ(s_bLateCount, 0);
+
+    // Later changes are reported to all of them
+    value.value.integer = 0x51;
+    vpi_put_value(bh, &value, NULL, vpiNoDelay);
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+    TEST_CHECK_EQ(s_bCount, 3);
+    TEST_CHECK_EQ(s_bEarlyCount, 3);
+    TEST_CHECK_EQ(s_bLateCount, 1);
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), false);
+
+    vpi_remove_cb(blatecb);
+    blatecb.freed();
+    vpi_remove_cb(acb);
+    acb.freed();
+    vpi_remove_cb(bcb);
+    bcb.freed();
+    vpi_remove_cb(bearlycb);
+    bearlycb.freed();
+    return errors;
+}
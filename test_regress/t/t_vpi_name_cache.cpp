@@ -0,0 +1,60 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "TestCheck.h"
+#include "TestVpi.h"
+
+#include <memory>
+#include <new>
+
+int errors = 0;
+
+// Look up and write a signal through VPI, then check the model saw the write
+static void checkModel(VM_PREFIX* topp, int value) {
+    topp->eval();
+    TEST_CHECK_EQ(topp->o, 0x5a);
+    for (int lookup = 0; lookup < 2; ++lookup) {  // Second lookup is from the name cache
+        TestVpiHandle handle = vpi_handle_by_name(const_cast<PLI_BYTE8*>("top.t.x"), NULL);
+        TEST_CHECK_NZ(handle);
+        if (!handle) return;
+        s_vpi_value v;
+        v.format = vpiIntVal;
+        v.value.integer = value + lookup;
+        vpi_put_value(handle, &v, NULL, vpiNoDelay);
+        topp->eval();
+        TEST_CHECK_EQ(topp->o, value + lookup);
+    }
+}
+
+// Each context is made at the same address, so the name cache must not mistake a new
+// context for the destroyed one, and return the destroyed model's scopes and variables
+alignas(VerilatedContext) static char s_contextStorage[sizeof(VerilatedContext)];
+
+int main(int argc, char** argv) {
+    for (int model = 0; model < 3; ++model) {
+        VerilatedContext* const contextp = new (s_contextStorage) VerilatedContext;
+        contextp->commandArgs(argc, argv);
+        {
+            const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp, "top"}};
+            checkModel(topp.get(), 0x10 * (model + 1));
+            topp->final();
+        }
+        contextp->~VerilatedContext();
+    }
+    if (errors) return 10;
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
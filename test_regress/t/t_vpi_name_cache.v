@@ -0,0 +1,18 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   o
+   );
+   output [7:0] o;
+
+   reg [7:0] x /*verilator public_flat_rw*/;
+
+   assign o = x;
+
+   initial x = 8'h5a;
+endmodule